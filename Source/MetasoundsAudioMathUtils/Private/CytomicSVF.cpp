@@ -4,17 +4,71 @@
 // Code based on this algorithm: https://gist.github.com/hollance/2891d89c57adc71d9560bcf0e1e55c4b
 
 #include "CytomicSVF.h"
+#include "AudioUtils.h"
 #include "Math/UnrealMathUtility.h"
 #include "DSP/Dsp.h"
 
 namespace DSPProcessing
 {
 
+FSVFTanTable::FSVFTanTable()
+{
+	Table.SetNumUninitialized(Size + 2);
+	for (int32 Index = 0; Index <= Size; ++Index)
+	{
+		Table[Index] = (float)FMath::Tan(UE_DOUBLE_PI * (double)MaxNormalizedCutoff * (double)Index / (double)Size);
+	}
+	Table[Size + 1] = Table[Size];
+}
+
+const FSVFTanTable& FSVFTanTable::Get()
+{
+	static const FSVFTanTable TanTable;
+	return TanTable;
+}
+
+float FSVFTanTable::Lookup(const float InNormalizedCutoff) const
+{
+	// written so NaN clamps to 0
+	const float Clamped = InNormalizedCutoff > 0.0f ? FMath::Min(InNormalizedCutoff, MaxNormalizedCutoff) : 0.0f;
+	const float Position = Clamped * ((float)Size / MaxNormalizedCutoff);
+	const int32 Point = (int32)Position;
+	const float Frac = Position - (float)Point;
+
+	return Table[Point] + Frac * (Table[Point + 1] - Table[Point]);
+}
+
+void FSVFTanTable::ProcessBuffer(const float* InCutoff, const float InInvSampleRate, float* OutG, const int32 InNumSamples) const
+{
+	const float* Points = Table.GetData();
+	const float Scale = (float)Size / MaxNormalizedCutoff;
+
+	for (int32 Index = 0; Index < InNumSamples; ++Index)
+	{
+		const float Normalized = InCutoff[Index] * InInvSampleRate;
+		const float Position = (Normalized > 0.0f ? FMath::Min(Normalized, MaxNormalizedCutoff) : 0.0f) * Scale;
+		const int32 Point = (int32)Position;
+		const float Frac = Position - (float)Point;
+
+		OutG[Index] = Points[Point] + Frac * (Points[Point + 1] - Points[Point]);
+	}
+}
+
 CytomicSVF::CytomicSVF()
 {
 	SetLPF();
 }
 
+void CytomicSVF::SetSampleRate(const float InSampleRate)
+{
+	if (InSampleRate > 0.0f && InSampleRate != fs)
+	{
+		fs = InSampleRate;
+		// g from the old rate is meaningless, don't ramp from it
+		bHasCoefficients = false;
+	}
+}
+
 void CytomicSVF::SetLPF()
 {
 	m0 = 0.0f;
@@ -22,7 +76,6 @@ void CytomicSVF::SetLPF()
 	m2 = 1.0f;
 }
 
-// currently feeding back so not exposed to MS node
 void CytomicSVF::setHPF()
 {
 	m0 = 1.0f;
@@ -37,24 +90,461 @@ void CytomicSVF::setBP()
 	m2 = 0.0f;
 }
 
+void CytomicSVF::SetUpdateRate(const ESVFUpdateRate InUpdateRate)
+{
+	switch (InUpdateRate)
+	{
+	case ESVFUpdateRate::Every8:
+		UpdateInterval = 8;
+		break;
+
+	case ESVFUpdateRate::Every16:
+		UpdateInterval = 16;
+		break;
+
+	case ESVFUpdateRate::Every32:
+		UpdateInterval = 32;
+		break;
+
+	default:
+		UpdateInterval = 1;
+		break;
+	}
+}
+
+void CytomicSVF::SetUseTanTable(const bool bInUseTanTable)
+{
+	TanTable = bInUseTanTable ? &FSVFTanTable::Get() : nullptr;
+}
+
+float CytomicSVF::CutoffToG(const float InCutoff) const
+{
+	return TanTable ? TanTable->Lookup(InCutoff * (1.0f / fs)) : Audio::FastTan(PI * InCutoff / fs);
+}
+
+void CytomicSVF::SetCoefficients(const float InG, const float InK)
+{
+	g = InG;
+	k = InK;
+	a1 = 1.0f / (1.0f + g * (g + k));
+	a2 = g * a1;
+	a3 = g * a2;
+}
+
+void CytomicSVF::SetMaxBlockSize(const int32 InMaxNumSamples)
+{
+	ScratchA1.SetNumUninitialized(InMaxNumSamples);
+	ScratchA2.SetNumUninitialized(InMaxNumSamples);
+	ScratchA3.SetNumUninitialized(InMaxNumSamples);
+	ScratchK.SetNumUninitialized(InMaxNumSamples);
+}
+
+// One trapezoidal integrator step, returns v2 and writes v1. State is passed by reference so callers can
+// keep it in locals, members would be reloaded after every store to OutBuffer.
+FORCEINLINE float TickSVF(const float InSample, const float InA1, const float InA2, const float InA3, float& InOutIC1, float& InOutIC2, float& OutV1)
+{
+	const float v3 = InSample - InOutIC2;
+	const float v1 = InA1 * InOutIC1 + InA2 * v3;
+	const float v2 = InOutIC2 + InA2 * InOutIC1 + InA3 * v3;
+	InOutIC1 = 2.0f * v1 - InOutIC1;
+	InOutIC2 = 2.0f * v2 - InOutIC2;
+
+	OutV1 = v1;
+	return v2;
+}
+
+// Audio::FastTan with the same operation order, unfused so it rounds identically
+FORCEINLINE VectorRegister4Float VectorFastTan(const VectorRegister4Float& X)
+{
+	const VectorRegister4Float X2 = VectorMultiply(X, X);
+	VectorRegister4Float Num = VectorAdd(VectorSetFloat1(-378.0f), X2);
+	Num = VectorAdd(VectorSetFloat1(17325.0f), VectorMultiply(X2, Num));
+	Num = VectorAdd(VectorSetFloat1(-135135.0f), VectorMultiply(X2, Num));
+	Num = VectorMultiply(X, Num);
+
+	VectorRegister4Float Den = VectorAdd(VectorSetFloat1(-3150.0f), VectorMultiply(VectorSetFloat1(28.0f), X2));
+	Den = VectorAdd(VectorSetFloat1(62370.0f), VectorMultiply(X2, Den));
+	Den = VectorAdd(VectorSetFloat1(-135135.0f), VectorMultiply(X2, Den));
+
+	return VectorDivide(Num, Den);
+}
+
+bool CytomicSVF::PrepareCoefficients(const float* CutoffFreq, const float* QAmount, const int32 InNumSamples)
+{
+	// static filter, coefficients once per block
+	if (IsBufferUniform(CutoffFreq, InNumSamples) && IsBufferUniform(QAmount, InNumSamples))
+	{
+		SetCoefficients(CutoffToG(CutoffFreq[0]), 1.0f / QAmount[0]);
+		bHasCoefficients = true;
+		return true;
+	}
+
+	// Modulated: the coefficient math is done up front into scratch so it can vectorise, leaving only
+	// the recurrence in the serial loop
+	if (ScratchK.Num() < InNumSamples)
+	{
+		SetMaxBlockSize(InNumSamples);
+	}
+
+	float* A1 = ScratchA1.GetData();
+	float* A2 = ScratchA2.GetData();
+	float* A3 = ScratchA3.GetData();
+	float* K = ScratchK.GetData();
+
+	// pass 1: g into A2 and k into K
+	if (UpdateInterval <= 1 && TanTable)
+	{
+		TanTable->ProcessBuffer(CutoffFreq, 1.0f / fs, A2, InNumSamples);
+
+		int32 i = 0;
+		for (; i + 4 <= InNumSamples; i += 4)
+		{
+			VectorStore(VectorDivide(VectorOneFloat(), VectorLoad(&QAmount[i])), &K[i]);
+		}
+
+		for (; i < InNumSamples; ++i)
+		{
+			K[i] = 1.0f / QAmount[i];
+		}
+	}
+	else if (UpdateInterval <= 1)
+	{
+		const VectorRegister4Float Pi = VectorSetFloat1(PI);
+		const VectorRegister4Float SampleRate = VectorSetFloat1(fs);
+		const VectorRegister4Float One = VectorOneFloat();
+
+		int32 i = 0;
+		for (; i + 4 <= InNumSamples; i += 4)
+		{
+			VectorStore(VectorFastTan(VectorDivide(VectorMultiply(Pi, VectorLoad(&CutoffFreq[i])), SampleRate)), &A2[i]);
+			VectorStore(VectorDivide(One, VectorLoad(&QAmount[i])), &K[i]);
+		}
+
+		for (; i < InNumSamples; ++i)
+		{
+			A2[i] = Audio::FastTan(PI * CutoffFreq[i] / fs);
+			K[i] = 1.0f / QAmount[i];
+		}
+	}
+	else
+	{
+		// control rate: g and k are computed at the last sample of each segment and ramped to from the previous
+		// segment, so they land exactly on the audio rate values at every update point
+		if (!bHasCoefficients)
+		{
+			g = CutoffToG(CutoffFreq[0]);
+			k = 1.0f / QAmount[0];
+		}
+
+		float G = g, KValue = k;
+		for (int32 Start = 0; Start < InNumSamples; Start += UpdateInterval)
+		{
+			const int32 End = FMath::Min(Start + UpdateInterval, InNumSamples);
+			const float TargetG = CutoffToG(CutoffFreq[End - 1]);
+			const float TargetK = 1.0f / QAmount[End - 1];
+
+			const float StepScale = 1.0f / (float)(End - Start);
+			const float GStep = (TargetG - G) * StepScale;
+			const float KStep = (TargetK - KValue) * StepScale;
+
+			for (int i = Start; i < End - 1; ++i)
+			{
+				const float Steps = (float)(i - Start + 1);
+				A2[i] = G + GStep * Steps;
+				K[i] = KValue + KStep * Steps;
+			}
+
+			// snap to the target so the ramps don't drift
+			G = TargetG;
+			KValue = TargetK;
+			A2[End - 1] = G;
+			K[End - 1] = KValue;
+		}
+	}
+
+	SetCoefficients(A2[InNumSamples - 1], K[InNumSamples - 1]);
+	bHasCoefficients = true;
+
+	// pass 1b: a1 = 1 / (1 + g(g + k)), a2 = g * a1, a3 = g * a2
+	{
+		const VectorRegister4Float One = VectorOneFloat();
+
+		int32 i = 0;
+		for (; i + 4 <= InNumSamples; i += 4)
+		{
+			const VectorRegister4Float G = VectorLoad(&A2[i]);
+			const VectorRegister4Float VectorA1 = VectorDivide(One, VectorAdd(One, VectorMultiply(G, VectorAdd(G, VectorLoad(&K[i])))));
+			const VectorRegister4Float VectorA2 = VectorMultiply(G, VectorA1);
+			VectorStore(VectorA1, &A1[i]);
+			VectorStore(VectorA2, &A2[i]);
+			VectorStore(VectorMultiply(G, VectorA2), &A3[i]);
+		}
+
+		for (; i < InNumSamples; ++i)
+		{
+			const float G = A2[i];
+			A1[i] = 1.0f / (1.0f + G * (G + K[i]));
+			A2[i] = G * A1[i];
+			A3[i] = G * A2[i];
+		}
+	}
+
+	return false;
+}
+
 void CytomicSVF::ProcessAudioBuffer(const float* InBuffer, float* OutBuffer, const float* CutoffFreq, const float* QAmount, const int32 InNumSamples)
 {
-	for (int i = 0; i < InNumSamples; ++i)
+	if (InNumSamples <= 0)
+	{
+		return;
+	}
+
+	const float M0 = m0, M1 = m1, M2 = m2;
+	float IC1 = ic1eq, IC2 = ic2eq;
+	float v1 = 0.0f;
+
+	// m0 mixes in the input rather than the output buffer, which used to feed the previous output back into high pass
+	if (PrepareCoefficients(CutoffFreq, QAmount, InNumSamples))
+	{
+		const float A1 = a1, A2 = a2, A3 = a3, BandGain = M1 * k;
+		for (int i = 0; i < InNumSamples; ++i)
+		{
+			const float Input = InBuffer[i];
+			const float v2 = TickSVF(Input, A1, A2, A3, IC1, IC2, v1);
+			OutBuffer[i] = M0 * Input + BandGain * v1 + M2 * v2;
+		}
+	}
+	else
+	{
+		const float* A1 = ScratchA1.GetData();
+		const float* A2 = ScratchA2.GetData();
+		const float* A3 = ScratchA3.GetData();
+		const float* K = ScratchK.GetData();
+
+		for (int i = 0; i < InNumSamples; ++i)
+		{
+			const float Input = InBuffer[i];
+			const float v2 = TickSVF(Input, A1[i], A2[i], A3[i], IC1, IC2, v1);
+			OutBuffer[i] = M0 * Input + M1 * K[i] * v1 + M2 * v2;
+		}
+	}
+
+	ic1eq = IC1;
+	ic2eq = IC2;
+}
+
+// All responses from one state update, band is k * v1 to match setBP(). Null outputs are skipped.
+FORCEINLINE void WriteMultimode(const int32 Index, const float InSample, const float InBand, const float InLow, float* OutLow, float* OutBand, float* OutHigh, float* OutNotch, float* OutPeak)
+{
+	const float High = InSample - InBand - InLow;
+
+	if (OutLow)
+	{
+		OutLow[Index] = InLow;
+	}
+	if (OutBand)
+	{
+		OutBand[Index] = InBand;
+	}
+	if (OutHigh)
+	{
+		OutHigh[Index] = High;
+	}
+	if (OutNotch)
+	{
+		OutNotch[Index] = InLow + High;
+	}
+	if (OutPeak)
+	{
+		OutPeak[Index] = InLow - High;
+	}
+}
+
+void CytomicSVF::ProcessAudioBufferMultimode(const float* InBuffer, const float* CutoffFreq, const float* QAmount, float* OutLow, float* OutBand, float* OutHigh, float* OutNotch, float* OutPeak, const int32 InNumSamples)
+{
+	if (InNumSamples <= 0)
+	{
+		return;
+	}
+
+	float IC1 = ic1eq, IC2 = ic2eq;
+	float v1 = 0.0f;
+
+	// the output writes are off the recurrence's critical path, so extra outputs are close to free
+	if (PrepareCoefficients(CutoffFreq, QAmount, InNumSamples))
+	{
+		const float A1 = a1, A2 = a2, A3 = a3, K = k;
+		for (int i = 0; i < InNumSamples; ++i)
+		{
+			const float Input = InBuffer[i];
+			const float v2 = TickSVF(Input, A1, A2, A3, IC1, IC2, v1);
+			WriteMultimode(i, Input, K * v1, v2, OutLow, OutBand, OutHigh, OutNotch, OutPeak);
+		}
+	}
+	else
+	{
+		const float* A1 = ScratchA1.GetData();
+		const float* A2 = ScratchA2.GetData();
+		const float* A3 = ScratchA3.GetData();
+		const float* K = ScratchK.GetData();
+
+		for (int i = 0; i < InNumSamples; ++i)
+		{
+			const float Input = InBuffer[i];
+			const float v2 = TickSVF(Input, A1[i], A2[i], A3[i], IC1, IC2, v1);
+			WriteMultimode(i, Input, K[i] * v1, v2, OutLow, OutBand, OutHigh, OutNotch, OutPeak);
+		}
+	}
+
+	ic1eq = IC1;
+	ic2eq = IC2;
+}
+
+void FCytomicSVFBank::SetNumFilters(const int32 InNumFilters)
+{
+	NumFilters = FMath::Max(InNumFilters, 0);
+	const int32 NumLanes = (NumFilters + 3) & ~3;
+
+	for (TArray<float>* Lanes : { &IC1, &IC2, &A1, &A2, &A3, &InputGain, &BandGain, &LowGain })
+	{
+		Lanes->SetNumZeroed(NumLanes);
+	}
+}
+
+void FCytomicSVFBank::SetSampleRate(const float InSampleRate)
+{
+	if (InSampleRate > 0.0f)
+	{
+		fs = InSampleRate;
+	}
+}
+
+void FCytomicSVFBank::SetLPF()
+{
+	m0 = 0.0f;
+	m1 = 0.0f;
+	m2 = 1.0f;
+}
+
+void FCytomicSVFBank::SetHPF()
+{
+	m0 = 1.0f;
+	m1 = -1.0f;
+	m2 = -1.0f;
+}
+
+void FCytomicSVFBank::SetBP()
+{
+	m0 = 0.0f;
+	m1 = 1.0f;
+	m2 = 0.0f;
+}
+
+void FCytomicSVFBank::SetFilter(const int32 InIndex, const float InCutoff, const float InQ, const float InGain)
+{
+	if (InIndex < 0 || InIndex >= NumFilters)
 	{
-		//calc coefficients
-		g = Audio::FastTan(PI * CutoffFreq[i] / fs);
-		k = 1.0f / QAmount[i];
-		a1 = 1.0f / (1.0f + g * (g + k));
-		a2 = g * a1;
-		a3 = g * a2;
+		return;
+	}
+
+	const float G = Audio::FastTan(PI * InCutoff / fs);
+	const float K = 1.0f / InQ;
+	A1[InIndex] = 1.0f / (1.0f + G * (G + K));
+	A2[InIndex] = G * A1[InIndex];
+	A3[InIndex] = G * A2[InIndex];
+
+	// the output mix and gain folded into one weight per term
+	InputGain[InIndex] = InGain * m0;
+	BandGain[InIndex] = InGain * m1 * K;
+	LowGain[InIndex] = InGain * m2;
+}
+
+// TickSVF for 4 filters at once, returns their gain weighted outputs
+FORCEINLINE VectorRegister4Float TickSVFLanes(const VectorRegister4Float& InInput, VectorRegister4Float& InOutState1, VectorRegister4Float& InOutState2,
+	const VectorRegister4Float& InA1, const VectorRegister4Float& InA2, const VectorRegister4Float& InA3,
+	const VectorRegister4Float& InInputGain, const VectorRegister4Float& InBandGain, const VectorRegister4Float& InLowGain)
+{
+	const VectorRegister4Float Two = VectorSetFloat1(2.0f);
+
+	const VectorRegister4Float v3 = VectorSubtract(InInput, InOutState2);
+	const VectorRegister4Float v1 = VectorMultiplyAdd(InA1, InOutState1, VectorMultiply(InA2, v3));
+	const VectorRegister4Float v2 = VectorAdd(InOutState2, VectorMultiplyAdd(InA2, InOutState1, VectorMultiply(InA3, v3)));
+	InOutState1 = VectorSubtract(VectorMultiply(Two, v1), InOutState1);
+	InOutState2 = VectorSubtract(VectorMultiply(Two, v2), InOutState2);
+
+	return VectorMultiplyAdd(InLowGain, v2, VectorMultiplyAdd(InBandGain, v1, VectorMultiply(InInputGain, InInput)));
+}
+
+FORCEINLINE float VectorHorizontalSum(const VectorRegister4Float& InValue)
+{
+	VectorRegister4Float Sum = VectorAdd(InValue, VectorSwizzle(InValue, 2, 3, 0, 1));
+	Sum = VectorAdd(Sum, VectorSwizzle(Sum, 1, 0, 3, 2));
+
+	float Result;
+	VectorStoreFloat1(Sum, &Result);
+	return Result;
+}
+
+void FCytomicSVFBank::ProcessAudioBuffer(const float* InBuffer, float* OutBuffer, const int32 InNumSamples)
+{
+	const int32 NumLanes = IC1.Num();
+	if (NumLanes == 0)
+	{
+		FMemory::Memzero(OutBuffer, InNumSamples * sizeof(float));
+		return;
+	}
+
+	float* IC1Lanes = IC1.GetData();
+	float* IC2Lanes = IC2.GetData();
+	const float* A1Lanes = A1.GetData();
+	const float* A2Lanes = A2.GetData();
+	const float* A3Lanes = A3.GetData();
+	const float* InputGainLanes = InputGain.GetData();
+	const float* BandGainLanes = BandGain.GetData();
+	const float* LowGainLanes = LowGain.GetData();
+
+	// up to 4 filters: everything stays in registers for the block
+	if (NumLanes == 4)
+	{
+		VectorRegister4Float State1 = VectorLoad(IC1Lanes);
+		VectorRegister4Float State2 = VectorLoad(IC2Lanes);
+		const VectorRegister4Float Coef1 = VectorLoad(A1Lanes);
+		const VectorRegister4Float Coef2 = VectorLoad(A2Lanes);
+		const VectorRegister4Float Coef3 = VectorLoad(A3Lanes);
+		const VectorRegister4Float Gain0 = VectorLoad(InputGainLanes);
+		const VectorRegister4Float Gain1 = VectorLoad(BandGainLanes);
+		const VectorRegister4Float Gain2 = VectorLoad(LowGainLanes);
+
+		for (int32 i = 0; i < InNumSamples; ++i)
+		{
+			OutBuffer[i] = VectorHorizontalSum(TickSVFLanes(VectorSetFloat1(InBuffer[i]), State1, State2, Coef1, Coef2, Coef3, Gain0, Gain1, Gain2));
+		}
+
+		VectorStore(State1, IC1Lanes);
+		VectorStore(State2, IC2Lanes);
+		return;
+	}
+
+	// sample outer, filters inner: every group of 4 is an independent recurrence, so groups overlap
+	// instead of each waiting on its own latency
+	for (int32 i = 0; i < InNumSamples; ++i)
+	{
+		const VectorRegister4Float Input = VectorSetFloat1(InBuffer[i]);
+		VectorRegister4Float Sum = VectorZeroFloat();
+
+		for (int32 Lane = 0; Lane < NumLanes; Lane += 4)
+		{
+			VectorRegister4Float State1 = VectorLoad(&IC1Lanes[Lane]);
+			VectorRegister4Float State2 = VectorLoad(&IC2Lanes[Lane]);
+
+			Sum = VectorAdd(Sum, TickSVFLanes(Input, State1, State2, VectorLoad(&A1Lanes[Lane]), VectorLoad(&A2Lanes[Lane]), VectorLoad(&A3Lanes[Lane]),
+				VectorLoad(&InputGainLanes[Lane]), VectorLoad(&BandGainLanes[Lane]), VectorLoad(&LowGainLanes[Lane])));
 
-		float v3 = InBuffer[i] - ic2eq;
-		float v1 = a1 * ic1eq + a2 * v3;
-		float v2 = ic2eq + a2 * ic1eq + a3 * v3;
-		ic1eq = 2.0f * v1 - ic1eq;
-		ic2eq = 2.0f * v2 - ic2eq;
+			VectorStore(State1, &IC1Lanes[Lane]);
+			VectorStore(State2, &IC2Lanes[Lane]);
+		}
 
-		OutBuffer[i] = m0 * OutBuffer[i] + m1 * k * v1 + m2 * v2;
+		OutBuffer[i] = VectorHorizontalSum(Sum);
 	}
 }
 
@@ -122,32 +122,7 @@ namespace Metasound
 
 		const int32 NumSamples = AudioInput->Num();
 
-		switch (*mComparisonType)
-		{
-		case EAudioComparisonType::Equals:
-			for (int32 Index = 0; Index < NumSamples; ++Index) OutputAudio[Index] = InputAudio[Index] == InputCompareComparator[Index];
-			break;
-
-		case EAudioComparisonType::NotEquals:
-			for (int32 Index = 0; Index < NumSamples; ++Index) OutputAudio[Index] = InputAudio[Index] != InputCompareComparator[Index];
-			break;
-
-		case EAudioComparisonType::LessThan:
-			for (int32 Index = 0; Index < NumSamples; ++Index) OutputAudio[Index] = InputAudio[Index] < InputCompareComparator[Index];
-			break;
-
-		case EAudioComparisonType::GreaterThan:
-			for (int32 Index = 0; Index < NumSamples; ++Index) OutputAudio[Index] = InputAudio[Index] > InputCompareComparator[Index];
-			break;
-
-		case EAudioComparisonType::LessThanOrEquals:
-			for (int32 Index = 0; Index < NumSamples; ++Index) OutputAudio[Index] = InputAudio[Index] <= InputCompareComparator[Index];
-			break;
-
-		case EAudioComparisonType::GreaterThanOrEquals:
-			for (int32 Index = 0; Index < NumSamples; ++Index) OutputAudio[Index] = InputAudio[Index] >= InputCompareComparator[Index];
-			break;
-		}
+		DSPProcessing::FCompare::ProcessAudioBuffer(ToDSPComparison(*mComparisonType), InputAudio, InputCompareComparator, OutputAudio, NumSamples);
 	}
 
 	FNodeClassMetadata FCompareNode::CreateNodeClassMetadata()
@@ -13,6 +13,7 @@ namespace Metasound
 		METASOUND_PARAM(InParamNameAudioInput, "In", "Audio input.")
 			METASOUND_PARAM(InParamNameAudioDivide, "AudioDivide", "The value to divide by")
 
+			METASOUND_PARAM(InParamNameAccuracy, "Accuracy", "Precise divides. Fast multiplies by a refined reciprocal estimate, ~1e-4 relative error.")
 			// Output params
 			METASOUND_PARAM(OutParamNameAudio, "Out", "Audio output.")
 	}
@@ -20,10 +21,11 @@ namespace Metasound
 	//------------------------------------------------------------------------------------
 	// FAudioDivideOperator
 	//------------------------------------------------------------------------------------
-	FAudioDivideOperator::FAudioDivideOperator(const FOperatorSettings& InSettings, const FAudioBufferReadRef& InAudioInput, const FAudioBufferReadRef& InAudioDivide)
+	FAudioDivideOperator::FAudioDivideOperator(const FOperatorSettings& InSettings, const FAudioBufferReadRef& InAudioInput, const FAudioBufferReadRef& InAudioDivide, const FEnumAudioAccuracyReadRef& InAccuracy)
 		: AudioInput(InAudioInput)
 		, AudioOutput(FAudioBufferWriteRef::CreateNew(InSettings))
 		, mInAudioDivide(InAudioDivide)
+		, mAccuracy(InAccuracy)
 	{
 
 	}
@@ -36,7 +38,7 @@ namespace Metasound
 
 				Info.ClassName = { TEXT("UE"), TEXT("AudioDivide (Audio)"), TEXT("Audio") };
 				Info.MajorVersion = 1;
-				Info.MinorVersion = 0;
+				Info.MinorVersion = 1;
 				Info.DisplayName = LOCTEXT("Metasound_AudioDivideDisplayName", "AudioDivide (Audio)");
 				Info.Description = LOCTEXT("Metasound_AudioDivideNodeDescription", "Divide input 1 by input 2. Divide by 0 locked to 0");
 				Info.Author = "Chris Wratt";
@@ -58,6 +60,7 @@ namespace Metasound
 
 		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InParamNameAudioInput), AudioInput);
 		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InParamNameAudioDivide), mInAudioDivide);
+		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InParamNameAccuracy), mAccuracy);
 	}
 
 	void FAudioDivideOperator::BindOutputs(FOutputVertexInterfaceData& InOutVertexData)
@@ -74,7 +77,8 @@ namespace Metasound
 		static const FVertexInterface Interface(
 			FInputVertexInterface(
 				TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameAudioInput)),
-				TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameAudioDivide))
+				TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameAudioDivide)),
+				TInputDataVertex<FEnumAudioAccuracy>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameAccuracy), (int32)EAudioAccuracy::Precise)
 			),
 
 			FOutputVertexInterface(
@@ -94,8 +98,9 @@ namespace Metasound
 		FAudioBufferReadRef AudioIn = InputInterface.GetOrCreateDefaultDataReadReference<FAudioBuffer>(METASOUND_GET_PARAM_NAME(InParamNameAudioInput), InParams.OperatorSettings);
 		FAudioBufferReadRef InAudioDivide = InputInterface.GetOrCreateDefaultDataReadReference<FAudioBuffer>(METASOUND_GET_PARAM_NAME(InParamNameAudioDivide), InParams.OperatorSettings);
 
+		FEnumAudioAccuracyReadRef InAccuracy = InputInterface.GetOrCreateDefaultDataReadReference<FEnumAudioAccuracy>(METASOUND_GET_PARAM_NAME(InParamNameAccuracy), InParams.OperatorSettings);
 
-		return MakeUnique<FAudioDivideOperator>(InParams.OperatorSettings, AudioIn, InAudioDivide);
+		return MakeUnique<FAudioDivideOperator>(InParams.OperatorSettings, AudioIn, InAudioDivide, InAccuracy);
 	}
 
 	void FAudioDivideOperator::Execute()
@@ -106,6 +111,7 @@ namespace Metasound
 
 		const int32 NumSamples = AudioInput->Num();
 
+		AudioDivideDSPProcessor.SetAccuracy((DSPProcessing::EAccuracy)*mAccuracy);
 		AudioDivideDSPProcessor.ProcessAudioBuffer(InputAudio, OutputAudio, InputAudioDivide, NumSamples);
 	}
 
@@ -0,0 +1,53 @@
+// Copyright Christopher Wratt 2024.
+// All code under MIT license: see https://mit-license.org/
+
+#include "MetasoundAudioMathUtilsEnums.h"
+#include "AudioUtils.h"
+#include "Oversampler.h"
+
+#define LOCTEXT_NAMESPACE "MetasoundAudioMathUtilsEnums"
+
+namespace Metasound
+{
+	DEFINE_METASOUND_ENUM_BEGIN(EAudioAccuracy, FEnumAudioAccuracy, "AudioAccuracy")
+		DEFINE_METASOUND_ENUM_ENTRY(EAudioAccuracy::Precise, "PreciseDescription", "Precise", "PreciseDescriptionTT", "Full float precision."),
+		DEFINE_METASOUND_ENUM_ENTRY(EAudioAccuracy::Fast, "FastDescription", "Fast", "FastDescriptionTT", "Hardware estimate refined once, ~1e-4 relative error."),
+	DEFINE_METASOUND_ENUM_END()
+
+	// The Sqrt and AudioDivide nodes cast this straight to the kernel's enum
+	static_assert((uint8)EAudioAccuracy::Precise == (uint8)DSPProcessing::EAccuracy::Precise, "EAudioAccuracy must match DSPProcessing::EAccuracy");
+	static_assert((uint8)EAudioAccuracy::Fast == (uint8)DSPProcessing::EAccuracy::Fast, "EAudioAccuracy must match DSPProcessing::EAccuracy");
+
+	DEFINE_METASOUND_ENUM_BEGIN(EAudioOversample, FEnumAudioOversample, "AudioOversample")
+		DEFINE_METASOUND_ENUM_ENTRY(EAudioOversample::None, "NoneDescription", "None", "NoneDescriptionTT", "Runs at the block rate."),
+		DEFINE_METASOUND_ENUM_ENTRY(EAudioOversample::X2, "X2Description", "2x", "X2DescriptionTT", "Runs at 2x the block rate through halfband filters, 32 samples of latency."),
+		DEFINE_METASOUND_ENUM_ENTRY(EAudioOversample::X4, "X4Description", "4x", "X4DescriptionTT", "Runs at 4x the block rate through halfband filters, 38 samples of latency."),
+	DEFINE_METASOUND_ENUM_END()
+
+	// The oversampling nodes cast this straight to the oversampler's enum
+	static_assert((uint8)EAudioOversample::None == (uint8)DSPProcessing::EOversample::None, "EAudioOversample must match DSPProcessing::EOversample");
+	static_assert((uint8)EAudioOversample::X2 == (uint8)DSPProcessing::EOversample::X2, "EAudioOversample must match DSPProcessing::EOversample");
+	static_assert((uint8)EAudioOversample::X4 == (uint8)DSPProcessing::EOversample::X4, "EAudioOversample must match DSPProcessing::EOversample");
+
+	DEFINE_METASOUND_ENUM_BEGIN(EAudioSineMode, FEnumAudioSineMode, "AudioSineMode")
+		DEFINE_METASOUND_ENUM_ENTRY(EAudioSineMode::Polynomial, "PolynomialDescription", "Polynomial", "PolynomialDescriptionTT", "Vectorised polynomial, max error ~1.4e-7."),
+		DEFINE_METASOUND_ENUM_ENTRY(EAudioSineMode::WavetableLinear, "WavetableLinearDescription", "Wavetable (Linear)", "WavetableLinearDescriptionTT", "Shared wavetable with linear interpolation. -94dB error at 512 points, -118dB at 2048."),
+		DEFINE_METASOUND_ENUM_ENTRY(EAudioSineMode::WavetableCubic, "WavetableCubicDescription", "Wavetable (Cubic)", "WavetableCubicDescriptionTT", "Shared wavetable with cubic interpolation, ~-135dB error at any table size."),
+	DEFINE_METASOUND_ENUM_END()
+
+	DEFINE_METASOUND_ENUM_BEGIN(EAudioSineTableSize, FEnumAudioSineTableSize, "AudioSineTableSize")
+		DEFINE_METASOUND_ENUM_ENTRY(EAudioSineTableSize::Size512, "Size512Description", "512", "Size512DescriptionTT", ""),
+		DEFINE_METASOUND_ENUM_ENTRY(EAudioSineTableSize::Size2048, "Size2048Description", "2048", "Size2048DescriptionTT", ""),
+		DEFINE_METASOUND_ENUM_ENTRY(EAudioSineTableSize::Size8192, "Size8192Description", "8192", "Size8192DescriptionTT", ""),
+	DEFINE_METASOUND_ENUM_END()
+
+	// The Sine and Cos nodes cast these straight to the kernel's enums
+	static_assert((uint8)EAudioSineMode::Polynomial == (uint8)DSPProcessing::ESineMode::Polynomial, "EAudioSineMode must match DSPProcessing::ESineMode");
+	static_assert((uint8)EAudioSineMode::WavetableLinear == (uint8)DSPProcessing::ESineMode::WavetableLinear, "EAudioSineMode must match DSPProcessing::ESineMode");
+	static_assert((uint8)EAudioSineMode::WavetableCubic == (uint8)DSPProcessing::ESineMode::WavetableCubic, "EAudioSineMode must match DSPProcessing::ESineMode");
+	static_assert((uint8)EAudioSineTableSize::Size512 == (uint8)DSPProcessing::ESineTableSize::Size512, "EAudioSineTableSize must match DSPProcessing::ESineTableSize");
+	static_assert((uint8)EAudioSineTableSize::Size2048 == (uint8)DSPProcessing::ESineTableSize::Size2048, "EAudioSineTableSize must match DSPProcessing::ESineTableSize");
+	static_assert((uint8)EAudioSineTableSize::Size8192 == (uint8)DSPProcessing::ESineTableSize::Size8192, "EAudioSineTableSize must match DSPProcessing::ESineTableSize");
+}
+
+#undef LOCTEXT_NAMESPACE
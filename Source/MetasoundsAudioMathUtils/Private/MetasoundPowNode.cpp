@@ -12,6 +12,8 @@ namespace Metasound
 		// Input params
 		METASOUND_PARAM(InParamNameAudioInput, "In", "Audio input.")
 			METASOUND_PARAM(InParamNamePowerOf, "Pow", "The value to test the input against")
+			METASOUND_PARAM(InParamNameOversample, "Oversample", "Runs the kernel at a higher rate to cut aliasing from the nonlinearity, at the cost of CPU and latency.")
+			METASOUND_PARAM(InParamNameADAA, "ADAA", "Antiderivative anti-aliasing, a cheaper alternative to Oversample with about half a sample of delay. Ignored while Oversample is on.")
 
 			// Output params
 			METASOUND_PARAM(OutParamNameAudio, "Out", "Audio output.")
@@ -20,12 +22,15 @@ namespace Metasound
 	//------------------------------------------------------------------------------------
 	// FPowOperator
 	//------------------------------------------------------------------------------------
-	FPowOperator::FPowOperator(const FOperatorSettings& InSettings, const FAudioBufferReadRef& InAudioInput, const FAudioBufferReadRef& InPowerOf)
+	FPowOperator::FPowOperator(const FOperatorSettings& InSettings, const FAudioBufferReadRef& InAudioInput, const FAudioBufferReadRef& InPowerOf, const FEnumAudioOversampleReadRef& InOversample, const FBoolReadRef& InUseADAA)
 		: AudioInput(InAudioInput)
 		, AudioOutput(FAudioBufferWriteRef::CreateNew(InSettings))
 		, mInPowerOf(InPowerOf)
+		, mOversample(InOversample)
+		, mUseADAA(InUseADAA)
 	{
-
+		// both factors are allocated here, so changing Oversample in Execute only switches between them
+		PowProcessor.SetMaxBlockSize(InSettings.GetNumFramesPerBlock());
 	}
 
 	const FNodeClassMetadata& FPowOperator::GetNodeInfo()
@@ -36,7 +41,7 @@ namespace Metasound
 
 				Info.ClassName = { TEXT("UE"), TEXT("Pow (Audio)"), TEXT("Audio") };
 				Info.MajorVersion = 1;
-				Info.MinorVersion = 0;
+				Info.MinorVersion = 2;
 				Info.DisplayName = LOCTEXT("Metasound_PowDisplayName", "Pow (Audio)");
 				Info.Description = LOCTEXT("Metasound_PowNodeDescription", "Returns input 1 to the power of input 2");
 				Info.Author = "Chris Wratt";
@@ -58,6 +63,8 @@ namespace Metasound
 
 		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InParamNameAudioInput), AudioInput);
 		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InParamNamePowerOf), mInPowerOf);
+		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InParamNameOversample), mOversample);
+		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InParamNameADAA), mUseADAA);
 	}
 
 	void FPowOperator::BindOutputs(FOutputVertexInterfaceData& InOutVertexData)
@@ -74,7 +81,9 @@ namespace Metasound
 		static const FVertexInterface Interface(
 			FInputVertexInterface(
 				TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameAudioInput)),
-				TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNamePowerOf))
+				TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNamePowerOf)),
+				TInputDataVertex<FEnumAudioOversample>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameOversample), (int32)EAudioOversample::None),
+				TInputDataVertex<bool>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameADAA), false)
 			),
 
 			FOutputVertexInterface(
@@ -93,9 +102,11 @@ namespace Metasound
 
 		FAudioBufferReadRef AudioIn = InputInterface.GetOrCreateDefaultDataReadReference<FAudioBuffer>(METASOUND_GET_PARAM_NAME(InParamNameAudioInput), InParams.OperatorSettings);
 		FAudioBufferReadRef InPowerOf = InputInterface.GetOrCreateDefaultDataReadReference<FAudioBuffer>(METASOUND_GET_PARAM_NAME(InParamNamePowerOf), InParams.OperatorSettings);
+		FEnumAudioOversampleReadRef InOversample = InputInterface.GetOrCreateDefaultDataReadReference<FEnumAudioOversample>(METASOUND_GET_PARAM_NAME(InParamNameOversample), InParams.OperatorSettings);
+		FBoolReadRef InUseADAA = InputInterface.GetOrCreateDefaultDataReadReference<bool>(METASOUND_GET_PARAM_NAME(InParamNameADAA), InParams.OperatorSettings);
 
 
-		return MakeUnique<FPowOperator>(InParams.OperatorSettings, AudioIn, InPowerOf);
+		return MakeUnique<FPowOperator>(InParams.OperatorSettings, AudioIn, InPowerOf, InOversample, InUseADAA);
 	}
 
 	void FPowOperator::Execute()
@@ -106,7 +117,8 @@ namespace Metasound
 
 		const int32 NumSamples = AudioInput->Num();
 
-		PowDSPProcessor.ProcessAudioBuffer(InputAudio, OutputAudio, InputPowerOf, NumSamples);
+		PowProcessor.SetMode((DSPProcessing::EOversample)*mOversample, *mUseADAA);
+		PowProcessor.ProcessAudioBuffer(InputAudio, OutputAudio, InputPowerOf, NumSamples);
 	}
 
 
@@ -11,6 +11,8 @@ namespace Metasound
 	{
 		// Input params
 		METASOUND_PARAM(InParamNameAudioInput, "In", "Audio input.")
+			METASOUND_PARAM(InParamNameOversample, "Oversample", "Runs the kernel at a higher rate to cut aliasing from the nonlinearity, at the cost of CPU and latency.")
+			METASOUND_PARAM(InParamNameADAA, "ADAA", "Antiderivative anti-aliasing, a cheaper alternative to Oversample with about half a sample of delay. Ignored while Oversample is on.")
 			// Output params
 			METASOUND_PARAM(OutParamNameAudio, "Out", "Audio output.")
 	}
@@ -18,11 +20,14 @@ namespace Metasound
 	//------------------------------------------------------------------------------------
 	// FReflectOperator
 	//------------------------------------------------------------------------------------
-	FReflectOperator::FReflectOperator(const FOperatorSettings& InSettings, const FAudioBufferReadRef& InAudioInput)
+	FReflectOperator::FReflectOperator(const FOperatorSettings& InSettings, const FAudioBufferReadRef& InAudioInput, const FEnumAudioOversampleReadRef& InOversample, const FBoolReadRef& InUseADAA)
 		: AudioInput(InAudioInput)
 		, AudioOutput(FAudioBufferWriteRef::CreateNew(InSettings))
+		, mOversample(InOversample)
+		, mUseADAA(InUseADAA)
 	{
-
+		// both factors are allocated here, so changing Oversample in Execute only switches between them
+		ReflectProcessor.SetMaxBlockSize(InSettings.GetNumFramesPerBlock());
 	}
 
 	const FNodeClassMetadata& FReflectOperator::GetNodeInfo()
@@ -33,7 +38,7 @@ namespace Metasound
 
 				Info.ClassName = { TEXT("UE"), TEXT("Reflect (Audio)"), TEXT("Audio") };
 				Info.MajorVersion = 1;
-				Info.MinorVersion = 0;
+				Info.MinorVersion = 2;
 				Info.DisplayName = LOCTEXT("Metasound_ReflectDisplayName", "Reflect (Audio)");
 				Info.Description = LOCTEXT("Metasound_ReflectNodeDescription", "Applies Reflect to the audio input.");
 				Info.Author = "geekrelief";
@@ -54,6 +59,8 @@ namespace Metasound
 		using namespace ReflectNode;
 
 		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InParamNameAudioInput), AudioInput);
+		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InParamNameOversample), mOversample);
+		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InParamNameADAA), mUseADAA);
 	}
 
 	void FReflectOperator::BindOutputs(FOutputVertexInterfaceData& InOutVertexData)
@@ -69,7 +76,10 @@ namespace Metasound
 
 		static const FVertexInterface Interface(
 			FInputVertexInterface(
-				TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameAudioInput))),
+				TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameAudioInput)),
+				TInputDataVertex<FEnumAudioOversample>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameOversample), (int32)EAudioOversample::None),
+				TInputDataVertex<bool>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameADAA), false)
+			),
 
 			FOutputVertexInterface(
 				TOutputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutParamNameAudio))
@@ -86,8 +96,10 @@ namespace Metasound
 		const FInputVertexInterfaceData& InputInterface = InParams.InputData;
 
 		FAudioBufferReadRef AudioIn = InputInterface.GetOrCreateDefaultDataReadReference<FAudioBuffer>(METASOUND_GET_PARAM_NAME(InParamNameAudioInput), InParams.OperatorSettings);
+		FEnumAudioOversampleReadRef InOversample = InputInterface.GetOrCreateDefaultDataReadReference<FEnumAudioOversample>(METASOUND_GET_PARAM_NAME(InParamNameOversample), InParams.OperatorSettings);
+		FBoolReadRef InUseADAA = InputInterface.GetOrCreateDefaultDataReadReference<bool>(METASOUND_GET_PARAM_NAME(InParamNameADAA), InParams.OperatorSettings);
 
-		return MakeUnique<FReflectOperator>(InParams.OperatorSettings, AudioIn);
+		return MakeUnique<FReflectOperator>(InParams.OperatorSettings, AudioIn, InOversample, InUseADAA);
 	}
 
 	void FReflectOperator::Execute()
@@ -97,7 +109,8 @@ namespace Metasound
 
 		const int32 NumSamples = AudioInput->Num();
 
-		ReflectDSPProcessor.ProcessAudioBuffer(InputAudio, OutputAudio, NumSamples);
+		ReflectProcessor.SetMode((DSPProcessing::EOversample)*mOversample, *mUseADAA);
+		ReflectProcessor.ProcessAudioBuffer(InputAudio, OutputAudio, NumSamples);
 	}
 
 
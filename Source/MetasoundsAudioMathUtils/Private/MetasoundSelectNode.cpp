@@ -0,0 +1,136 @@
+// Copyright Christopher Wratt 2024.
+// All code under MIT license: see https://mit-license.org/
+
+#include "MetasoundSelectNode.h"
+
+#define LOCTEXT_NAMESPACE "MetasoundNodeTemplate_SelectNode"
+
+namespace Metasound
+{
+	namespace SelectNode
+	{
+		// Input params
+		METASOUND_PARAM(InParamNameA, "A", "Left hand side of the comparison.")
+			METASOUND_PARAM(InParamNameB, "B", "Right hand side of the comparison.")
+			METASOUND_PARAM(InputCompareType, "Type", "How to compare A and B.")
+			METASOUND_PARAM(InParamNameX, "True", "Output where the comparison is true.")
+			METASOUND_PARAM(InParamNameY, "False", "Output where the comparison is false.")
+
+			// Output params
+			METASOUND_PARAM(OutParamNameAudio, "Out", "Audio output.")
+	}
+
+	//------------------------------------------------------------------------------------
+	// FSelectOperator
+	//------------------------------------------------------------------------------------
+	FSelectOperator::FSelectOperator(const FOperatorSettings& InSettings, const FAudioBufferReadRef& InA, const FAudioBufferReadRef& InB, const FAudioBufferReadRef& InX, const FAudioBufferReadRef& InY, const FEnumAudioCompareTypeReadRef& InComparisonTypeReadRef)
+		: mInA(InA)
+		, mInB(InB)
+		, mInX(InX)
+		, mInY(InY)
+		, mComparisonType(InComparisonTypeReadRef)
+		, AudioOutput(FAudioBufferWriteRef::CreateNew(InSettings))
+	{
+
+	}
+
+	const FNodeClassMetadata& FSelectOperator::GetNodeInfo()
+	{
+		auto InitNodeInfo = []() -> FNodeClassMetadata
+			{
+				FNodeClassMetadata Info;
+
+				Info.ClassName = { TEXT("UE"), TEXT("Select (Audio)"), TEXT("Audio") };
+				Info.MajorVersion = 1;
+				Info.MinorVersion = 0;
+				Info.DisplayName = LOCTEXT("Metasound_SelectDisplayName", "Select (Audio)");
+				Info.Description = LOCTEXT("Metasound_SelectNodeDescription", "Outputs True where A compared to B holds and False elsewhere, per sample. Replaces Compare (Audio) feeding multiplies or gates.");
+				Info.Author = PluginAuthor;
+				Info.PromptIfMissing = PluginNodeMissingPrompt;
+				Info.DefaultInterface = GetVertexInterface();
+				Info.CategoryHierarchy = { LOCTEXT("Metasound_SelectNodeCategory", "Utils") };
+
+				return Info;
+			};
+
+		static const FNodeClassMetadata Info = InitNodeInfo();
+
+		return Info;
+	}
+
+	void FSelectOperator::BindInputs(FInputVertexInterfaceData& InOutVertexData)
+	{
+		using namespace SelectNode;
+
+		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InParamNameA), mInA);
+		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InParamNameB), mInB);
+		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InputCompareType), mComparisonType);
+		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InParamNameX), mInX);
+		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InParamNameY), mInY);
+	}
+
+	void FSelectOperator::BindOutputs(FOutputVertexInterfaceData& InOutVertexData)
+	{
+		using namespace SelectNode;
+
+		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(OutParamNameAudio), AudioOutput);
+	}
+
+	const FVertexInterface& FSelectOperator::GetVertexInterface()
+	{
+		using namespace SelectNode;
+
+		static const FVertexInterface Interface(
+			FInputVertexInterface(
+				TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameA)),
+				TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameB)),
+				TInputDataVertex<FEnumAudioCompareType>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputCompareType), (int32)EAudioComparisonType::Equals),
+				TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameX)),
+				TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameY))
+			),
+
+			FOutputVertexInterface(
+				TOutputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutParamNameAudio))
+			)
+		);
+
+		return Interface;
+	}
+
+	TUniquePtr<IOperator> FSelectOperator::CreateOperator(const FBuildOperatorParams& InParams, FBuildResults& OutErrors)
+	{
+		using namespace SelectNode;
+
+		const FInputVertexInterfaceData& InputInterface = InParams.InputData;
+
+		FAudioBufferReadRef InA = InputInterface.GetOrCreateDefaultDataReadReference<FAudioBuffer>(METASOUND_GET_PARAM_NAME(InParamNameA), InParams.OperatorSettings);
+		FAudioBufferReadRef InB = InputInterface.GetOrCreateDefaultDataReadReference<FAudioBuffer>(METASOUND_GET_PARAM_NAME(InParamNameB), InParams.OperatorSettings);
+		FAudioBufferReadRef InX = InputInterface.GetOrCreateDefaultDataReadReference<FAudioBuffer>(METASOUND_GET_PARAM_NAME(InParamNameX), InParams.OperatorSettings);
+		FAudioBufferReadRef InY = InputInterface.GetOrCreateDefaultDataReadReference<FAudioBuffer>(METASOUND_GET_PARAM_NAME(InParamNameY), InParams.OperatorSettings);
+		FEnumAudioCompareTypeReadRef InComparison = InputInterface.GetOrCreateDefaultDataReadReference<FEnumAudioCompareType>(METASOUND_GET_PARAM_NAME(InputCompareType), InParams.OperatorSettings);
+
+		return MakeUnique<FSelectOperator>(InParams.OperatorSettings, InA, InB, InX, InY, InComparison);
+	}
+
+	void FSelectOperator::Execute()
+	{
+		const float* InputA = mInA->GetData();
+		const float* InputB = mInB->GetData();
+		const float* InputX = mInX->GetData();
+		const float* InputY = mInY->GetData();
+		float* OutputAudio = AudioOutput->GetData();
+
+		const int32 NumSamples = AudioOutput->Num();
+
+		DSPProcessing::FSelect::ProcessAudioBuffer(ToDSPComparison(*mComparisonType), InputA, InputB, InputX, InputY, OutputAudio, NumSamples);
+	}
+
+	FNodeClassMetadata FSelectNode::CreateNodeClassMetadata()
+	{
+		return FSelectOperator::GetNodeInfo();
+	}
+
+	METASOUND_REGISTER_NODE(FSelectNode)
+}
+
+#undef LOCTEXT_NAMESPACE
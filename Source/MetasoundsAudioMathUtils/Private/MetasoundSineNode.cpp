@@ -11,6 +11,8 @@ namespace Metasound
 	{
 		// Input params
 		METASOUND_PARAM(InParamNameAudioInput, "In", "Audio input.")
+			METASOUND_PARAM(InParamNameMode, "Mode", "Polynomial, or lookup in a wavetable shared by every Sine and Cos node.")
+			METASOUND_PARAM(InParamNameTableSize, "Table Size", "Points per cycle in wavetable modes.")
 			// Output params
 			METASOUND_PARAM(OutParamNameAudio, "Out", "Audio output.")
 	}
@@ -18,11 +20,16 @@ namespace Metasound
 	//------------------------------------------------------------------------------------
 	// FSineOperator
 	//------------------------------------------------------------------------------------
-	FSineOperator::FSineOperator(const FOperatorSettings& InSettings, const FAudioBufferReadRef& InAudioInput)
+	FSineOperator::FSineOperator(const FOperatorSettings& InSettings, const FAudioBufferReadRef& InAudioInput, const FEnumAudioSineModeReadRef& InMode, const FEnumAudioSineTableSizeReadRef& InTableSize)
 		: AudioInput(InAudioInput)
 		, AudioOutput(FAudioBufferWriteRef::CreateNew(InSettings))
+		, mMode(InMode)
+		, mTableSize(InTableSize)
+		, mCurrentMode(*InMode)
+		, mCurrentTableSize(*InTableSize)
 	{
-
+		// builds the wavetable here rather than in the first Execute, if this is the first node to use its size
+		SineDSPProcessor.SetMode((DSPProcessing::ESineMode)mCurrentMode, (DSPProcessing::ESineTableSize)mCurrentTableSize);
 	}
 
 	const FNodeClassMetadata& FSineOperator::GetNodeInfo()
@@ -33,7 +40,7 @@ namespace Metasound
 
 				Info.ClassName = { TEXT("UE"), TEXT("Sine (Audio)"), TEXT("Audio") };
 				Info.MajorVersion = 1;
-				Info.MinorVersion = 0;
+				Info.MinorVersion = 1;
 				Info.DisplayName = LOCTEXT("Metasound_SineDisplayName", "Sine (Audio)");
 				Info.Description = LOCTEXT("Metasound_SineNodeDescription", "Applies Sine(2PI(Input))");
 				Info.Author = PluginAuthor;
@@ -54,6 +61,8 @@ namespace Metasound
 		using namespace SineNode;
 
 		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InParamNameAudioInput), AudioInput);
+		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InParamNameMode), mMode);
+		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InParamNameTableSize), mTableSize);
 	}
 
 	void FSineOperator::BindOutputs(FOutputVertexInterfaceData& InOutVertexData)
@@ -69,7 +78,10 @@ namespace Metasound
 
 		static const FVertexInterface Interface(
 			FInputVertexInterface(
-				TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameAudioInput))),
+				TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameAudioInput)),
+				TInputDataVertex<FEnumAudioSineMode>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameMode), (int32)EAudioSineMode::Polynomial),
+				TInputDataVertex<FEnumAudioSineTableSize>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameTableSize), (int32)EAudioSineTableSize::Size2048)
+			),
 
 			FOutputVertexInterface(
 				TOutputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutParamNameAudio))
@@ -86,8 +98,10 @@ namespace Metasound
 		const FInputVertexInterfaceData& InputInterface = InParams.InputData;
 
 		FAudioBufferReadRef AudioIn = InputInterface.GetOrCreateDefaultDataReadReference<FAudioBuffer>(METASOUND_GET_PARAM_NAME(InParamNameAudioInput), InParams.OperatorSettings);
+		FEnumAudioSineModeReadRef InMode = InputInterface.GetOrCreateDefaultDataReadReference<FEnumAudioSineMode>(METASOUND_GET_PARAM_NAME(InParamNameMode), InParams.OperatorSettings);
+		FEnumAudioSineTableSizeReadRef InTableSize = InputInterface.GetOrCreateDefaultDataReadReference<FEnumAudioSineTableSize>(METASOUND_GET_PARAM_NAME(InParamNameTableSize), InParams.OperatorSettings);
 
-		return MakeUnique<FSineOperator>(InParams.OperatorSettings, AudioIn);
+		return MakeUnique<FSineOperator>(InParams.OperatorSettings, AudioIn, InMode, InTableSize);
 	}
 
 	void FSineOperator::Execute()
@@ -97,6 +111,12 @@ namespace Metasound
 
 		const int32 NumSamples = AudioInput->Num();
 
+		if (*mMode != mCurrentMode || *mTableSize != mCurrentTableSize)
+		{
+			mCurrentMode = *mMode;
+			mCurrentTableSize = *mTableSize;
+			SineDSPProcessor.SetMode((DSPProcessing::ESineMode)mCurrentMode, (DSPProcessing::ESineTableSize)mCurrentTableSize);
+		}
 		SineDSPProcessor.ProcessAudioBuffer(InputAudio, OutputAudio, NumSamples);
 	}
 
@@ -11,6 +11,8 @@ namespace Metasound
 	{
 		// Input params
 		METASOUND_PARAM(InParamNameAudioInput, "In", "Audio input.")
+			METASOUND_PARAM(InParamNameAccuracy, "Accuracy", "Precise uses hardware sqrt. Fast uses a reciprocal sqrt estimate, ~1e-4 relative error.")
+			METASOUND_PARAM(InParamNameOversample, "Oversample", "Runs the kernel at a higher rate to cut aliasing from the nonlinearity, at the cost of CPU and latency.")
 			// Output params
 			METASOUND_PARAM(OutParamNameAudio, "Out", "Audio output.")
 	}
@@ -18,11 +20,14 @@ namespace Metasound
 	//------------------------------------------------------------------------------------
 	// FSqrtOperator
 	//------------------------------------------------------------------------------------
-	FSqrtOperator::FSqrtOperator(const FOperatorSettings& InSettings, const FAudioBufferReadRef& InAudioInput)
+	FSqrtOperator::FSqrtOperator(const FOperatorSettings& InSettings, const FAudioBufferReadRef& InAudioInput, const FEnumAudioAccuracyReadRef& InAccuracy, const FEnumAudioOversampleReadRef& InOversample)
 		: AudioInput(InAudioInput)
 		, AudioOutput(FAudioBufferWriteRef::CreateNew(InSettings))
+		, mAccuracy(InAccuracy)
+		, mOversample(InOversample)
 	{
-
+		// both factors are allocated here, so changing Oversample in Execute only switches between them
+		SqrtProcessor.SetMaxBlockSize(InSettings.GetNumFramesPerBlock());
 	}
 
 	const FNodeClassMetadata& FSqrtOperator::GetNodeInfo()
@@ -33,7 +38,7 @@ namespace Metasound
 
 				Info.ClassName = { TEXT("UE"), TEXT("Sqrt"), TEXT("Audio") };
 				Info.MajorVersion = 1;
-				Info.MinorVersion = 0;
+				Info.MinorVersion = 2;
 				Info.DisplayName = LOCTEXT("Metasound_SqrtDisplayName", "Sqrt (Audio)");
 				Info.Description = LOCTEXT("Metasound_SqrtNodeDescription", "Applies Sqrt to the audio input.");
 				Info.Author = PluginAuthor;
@@ -54,6 +59,8 @@ namespace Metasound
 		using namespace SqrtNode;
 
 		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InParamNameAudioInput), AudioInput);
+		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InParamNameAccuracy), mAccuracy);
+		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InParamNameOversample), mOversample);
 	}
 
 	void FSqrtOperator::BindOutputs(FOutputVertexInterfaceData& InOutVertexData)
@@ -69,7 +76,10 @@ namespace Metasound
 
 		static const FVertexInterface Interface(
 			FInputVertexInterface(
-				TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameAudioInput))),
+				TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameAudioInput)),
+				TInputDataVertex<FEnumAudioAccuracy>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameAccuracy), (int32)EAudioAccuracy::Precise),
+				TInputDataVertex<FEnumAudioOversample>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameOversample), (int32)EAudioOversample::None)
+			),
 
 			FOutputVertexInterface(
 				TOutputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutParamNameAudio))
@@ -86,8 +96,10 @@ namespace Metasound
 		const FInputVertexInterfaceData& InputInterface = InParams.InputData;
 
 		FAudioBufferReadRef AudioIn = InputInterface.GetOrCreateDefaultDataReadReference<FAudioBuffer>(METASOUND_GET_PARAM_NAME(InParamNameAudioInput), InParams.OperatorSettings);
+		FEnumAudioAccuracyReadRef InAccuracy = InputInterface.GetOrCreateDefaultDataReadReference<FEnumAudioAccuracy>(METASOUND_GET_PARAM_NAME(InParamNameAccuracy), InParams.OperatorSettings);
+		FEnumAudioOversampleReadRef InOversample = InputInterface.GetOrCreateDefaultDataReadReference<FEnumAudioOversample>(METASOUND_GET_PARAM_NAME(InParamNameOversample), InParams.OperatorSettings);
 
-		return MakeUnique<FSqrtOperator>(InParams.OperatorSettings, AudioIn);
+		return MakeUnique<FSqrtOperator>(InParams.OperatorSettings, AudioIn, InAccuracy, InOversample);
 	}
 
 	void FSqrtOperator::Execute()
@@ -97,7 +109,11 @@ namespace Metasound
 
 		const int32 NumSamples = AudioInput->Num();
 
-		SqrtDSPProcessor.ProcessAudioBuffer(InputAudio, OutputAudio, NumSamples);
+		const DSPProcessing::EAccuracy Accuracy = (DSPProcessing::EAccuracy)*mAccuracy;
+		SqrtProcessor.ForEachKernel([Accuracy](DSPProcessing::FSqrt& Kernel) { Kernel.SetAccuracy(Accuracy); });
+
+		SqrtProcessor.SetMode((DSPProcessing::EOversample)*mOversample);
+		SqrtProcessor.ProcessAudioBuffer(InputAudio, OutputAudio, NumSamples);
 	}
 
 
@@ -0,0 +1,166 @@
+// Copyright Christopher Wratt 2024.
+// All code under MIT license: see https://mit-license.org/
+
+#include "MetasoundVCFBankNode.h"
+
+#define LOCTEXT_NAMESPACE "MetasoundNodeTemplate_VCFBankNode"
+
+namespace Metasound
+{
+	namespace VCFBankNode
+	{
+		// Input params
+		METASOUND_PARAM(InParamNameAudioInput, "In", "Audio input, shared by every filter.")
+			METASOUND_PARAM(InParamNameCutoffs, "Cutoffs Hz", "Cutoff freq in Hz per filter, the number of cutoffs sets the number of filters.")
+			METASOUND_PARAM(InParamNameQs, "Qs", "Q per filter, filters past the end of the array use the last Q or 0.707 if empty.")
+			METASOUND_PARAM(InParamNameGains, "Gains", "Output gain per filter, filters past the end of the array use 1.")
+			METASOUND_PARAM(InParamNameFilterType, "FilterType", "The type of filter to apply")
+
+			// Output params
+			METASOUND_PARAM(OutParamNameAudio, "Out", "Sum of every filter's output times its gain.")
+	}
+
+	//------------------------------------------------------------------------------------
+	// FVCFBankOperator
+	//------------------------------------------------------------------------------------
+	FVCFBankOperator::FVCFBankOperator(const FOperatorSettings& InSettings, const FAudioBufferReadRef& InAudioInput, const TDataReadReference<TArray<float>>& InCutoffs, const TDataReadReference<TArray<float>>& InQs, const TDataReadReference<TArray<float>>& InGains, const FEnumVCFFilterTypeReadRef& InFilterType)
+		: AudioInput(InAudioInput)
+		, AudioOutput(FAudioBufferWriteRef::CreateNew(InSettings))
+		, mCutoffs(InCutoffs)
+		, mQs(InQs)
+		, mGains(InGains)
+		, mFilterType(InFilterType)
+	{
+		mCytomicSVFBank.SetSampleRate(InSettings.GetSampleRate());
+	}
+
+	const FNodeClassMetadata& FVCFBankOperator::GetNodeInfo()
+	{
+		auto InitNodeInfo = []() -> FNodeClassMetadata
+			{
+				FNodeClassMetadata Info;
+
+				Info.ClassName = { TEXT("UE"), TEXT("VCF Bank (Audio)"), TEXT("Audio") };
+				Info.MajorVersion = 1;
+				Info.MinorVersion = 0;
+				Info.DisplayName = LOCTEXT("Metasound_VCFBankDisplayName", "VCF Bank (Audio)");
+				Info.Description = LOCTEXT("Metasound_VCFBankNodeDescription", "A bank of VCFs on one input, summed with per filter gains. For vocoders and resonator banks, much cheaper per filter than separate VCF nodes. Cutoff, Q and gain update once per block.");
+				Info.Author = "Chris Wratt";
+				Info.PromptIfMissing = PluginNodeMissingPrompt;
+				Info.DefaultInterface = GetVertexInterface();
+				Info.CategoryHierarchy = { LOCTEXT("Metasound_VCFBankNodeCategory", "Utils") };
+
+				return Info;
+			};
+
+		static const FNodeClassMetadata Info = InitNodeInfo();
+
+		return Info;
+	}
+
+	void FVCFBankOperator::BindInputs(FInputVertexInterfaceData& InOutVertexData)
+	{
+		using namespace VCFBankNode;
+
+		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InParamNameAudioInput), AudioInput);
+		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InParamNameCutoffs), mCutoffs);
+		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InParamNameQs), mQs);
+		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InParamNameGains), mGains);
+		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InParamNameFilterType), mFilterType);
+	}
+
+	void FVCFBankOperator::BindOutputs(FOutputVertexInterfaceData& InOutVertexData)
+	{
+		using namespace VCFBankNode;
+
+		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(OutParamNameAudio), AudioOutput);
+	}
+
+	const FVertexInterface& FVCFBankOperator::GetVertexInterface()
+	{
+		using namespace VCFBankNode;
+
+		static const FVertexInterface Interface(
+			FInputVertexInterface(
+				TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameAudioInput)),
+				TInputDataVertex<TArray<float>>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameCutoffs)),
+				TInputDataVertex<TArray<float>>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameQs)),
+				TInputDataVertex<TArray<float>>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameGains)),
+				TInputDataVertex<FEnumVCFFilterType>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameFilterType), (int32)EVCFFilterType::BandPass)
+			),
+
+			FOutputVertexInterface(
+				TOutputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutParamNameAudio))
+			)
+		);
+
+		return Interface;
+	}
+
+	TUniquePtr<IOperator> FVCFBankOperator::CreateOperator(const FBuildOperatorParams& InParams, FBuildResults& OutErrors)
+	{
+		using namespace VCFBankNode;
+
+		const FInputVertexInterfaceData& InputInterface = InParams.InputData;
+
+		FAudioBufferReadRef AudioIn = InputInterface.GetOrCreateDefaultDataReadReference<FAudioBuffer>(METASOUND_GET_PARAM_NAME(InParamNameAudioInput), InParams.OperatorSettings);
+		TDataReadReference<TArray<float>> InCutoffs = InputInterface.GetOrCreateDefaultDataReadReference<TArray<float>>(METASOUND_GET_PARAM_NAME(InParamNameCutoffs), InParams.OperatorSettings);
+		TDataReadReference<TArray<float>> InQs = InputInterface.GetOrCreateDefaultDataReadReference<TArray<float>>(METASOUND_GET_PARAM_NAME(InParamNameQs), InParams.OperatorSettings);
+		TDataReadReference<TArray<float>> InGains = InputInterface.GetOrCreateDefaultDataReadReference<TArray<float>>(METASOUND_GET_PARAM_NAME(InParamNameGains), InParams.OperatorSettings);
+		FEnumVCFFilterTypeReadRef InFilterType = InputInterface.GetOrCreateDefaultDataReadReference<FEnumVCFFilterType>(METASOUND_GET_PARAM_NAME(InParamNameFilterType), InParams.OperatorSettings);
+
+		return MakeUnique<FVCFBankOperator>(InParams.OperatorSettings, AudioIn, InCutoffs, InQs, InGains, InFilterType);
+	}
+
+	void FVCFBankOperator::Execute()
+	{
+		const float* InputAudio = AudioInput->GetData();
+		float* OutputAudio = AudioOutput->GetData();
+
+		const int32 NumSamples = AudioInput->Num();
+
+		const TArray<float>& Cutoffs = *mCutoffs;
+		const TArray<float>& Qs = *mQs;
+		const TArray<float>& Gains = *mGains;
+
+		// only reallocates when the number of filters changes
+		if (mCytomicSVFBank.GetNumFilters() != Cutoffs.Num())
+		{
+			mCytomicSVFBank.SetNumFilters(Cutoffs.Num());
+		}
+
+		switch (*mFilterType)
+		{
+		case EVCFFilterType::LowPass:
+			mCytomicSVFBank.SetLPF();
+			break;
+
+		case EVCFFilterType::HighPass:
+			mCytomicSVFBank.SetHPF();
+			break;
+
+		default:
+			mCytomicSVFBank.SetBP();
+			break;
+		}
+
+		for (int32 Index = 0; Index < Cutoffs.Num(); ++Index)
+		{
+			const float Q = Qs.Num() > 0 ? Qs[FMath::Min(Index, Qs.Num() - 1)] : 0.707f;
+			const float Gain = Index < Gains.Num() ? Gains[Index] : 1.0f;
+			mCytomicSVFBank.SetFilter(Index, Cutoffs[Index], Q, Gain);
+		}
+
+		mCytomicSVFBank.ProcessAudioBuffer(InputAudio, OutputAudio, NumSamples);
+	}
+
+
+	FNodeClassMetadata FVCFBankNode::CreateNodeClassMetadata()
+	{
+		return FVCFBankOperator::GetNodeInfo();
+	}
+
+	METASOUND_REGISTER_NODE(FVCFBankNode)
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,154 @@
+// Copyright Christopher Wratt 2024.
+// All code under MIT license: see https://mit-license.org/
+
+#include "MetasoundVCFMultimodeNode.h"
+
+#define LOCTEXT_NAMESPACE "MetasoundNodeTemplate_VCFMultimodeNode"
+
+namespace Metasound
+{
+	namespace VCFMultimodeNode
+	{
+		// Input params
+		METASOUND_PARAM(InParamNameAudioInput, "In", "Audio input.")
+			METASOUND_PARAM(InParamNameVCFCutoff, "Cutoff Hz", "Cutoff freq in Hz")
+			METASOUND_PARAM(InParamNameVCFQ, "Q", "Q of 0.707 means no resonant peaking")
+			METASOUND_PARAM(InParamNameUpdateRate, "Update Rate", "How often Cutoff and Q are read. Slower rates are cheaper when modulating, a constant Cutoff and Q is always cheap.")
+			METASOUND_PARAM(InParamNameTanTable, "Tan Table", "Cutoff to coefficient through a shared tan table instead of the rational approximation. Cheaper for static and control rate cutoffs, ~4e-5 relative error near nyquist.")
+
+			// Output params
+			METASOUND_PARAM(OutParamNameLowPass, "Low Pass", "Low pass output.")
+			METASOUND_PARAM(OutParamNameBandPass, "Band Pass", "Band pass output, unity gain at the cutoff.")
+			METASOUND_PARAM(OutParamNameHighPass, "High Pass", "High pass output.")
+			METASOUND_PARAM(OutParamNameNotch, "Notch", "Notch output, low pass plus high pass.")
+			METASOUND_PARAM(OutParamNamePeak, "Peak", "Peak output, low pass minus high pass.")
+	}
+
+	//------------------------------------------------------------------------------------
+	// FVCFMultimodeOperator
+	//------------------------------------------------------------------------------------
+	FVCFMultimodeOperator::FVCFMultimodeOperator(const FOperatorSettings& InSettings, const FAudioBufferReadRef& InAudioInput, const FAudioBufferReadRef& InVCFCutoff, const FAudioBufferReadRef& InVCFQ, const FEnumVCFUpdateRateReadRef& InUpdateRate, const FBoolReadRef& InUseTanTable)
+		: AudioInput(InAudioInput)
+		, LowPassOutput(FAudioBufferWriteRef::CreateNew(InSettings))
+		, BandPassOutput(FAudioBufferWriteRef::CreateNew(InSettings))
+		, HighPassOutput(FAudioBufferWriteRef::CreateNew(InSettings))
+		, NotchOutput(FAudioBufferWriteRef::CreateNew(InSettings))
+		, PeakOutput(FAudioBufferWriteRef::CreateNew(InSettings))
+		, mInVCFCutoff(InVCFCutoff)
+		, mInVCFQ(InVCFQ)
+		, mUpdateRate(InUpdateRate)
+		, mUseTanTable(InUseTanTable)
+	{
+		mCytomicSVF.SetSampleRate(InSettings.GetSampleRate());
+		mCytomicSVF.SetMaxBlockSize(InSettings.GetNumFramesPerBlock());
+	}
+
+	const FNodeClassMetadata& FVCFMultimodeOperator::GetNodeInfo()
+	{
+		auto InitNodeInfo = []() -> FNodeClassMetadata
+			{
+				FNodeClassMetadata Info;
+
+				Info.ClassName = { TEXT("UE"), TEXT("VCF Multimode (Audio)"), TEXT("Audio") };
+				Info.MajorVersion = 1;
+				Info.MinorVersion = 1;
+				Info.DisplayName = LOCTEXT("Metasound_VCFMultimodeDisplayName", "VCF Multimode (Audio)");
+				Info.Description = LOCTEXT("Metasound_VCFMultimodeNodeDescription", "The VCF with low pass, band pass, high pass, notch and peak outputs from a single filter. Costs about the same as one VCF.");
+				Info.Author = "Chris Wratt";
+				Info.PromptIfMissing = PluginNodeMissingPrompt;
+				Info.DefaultInterface = GetVertexInterface();
+				Info.CategoryHierarchy = { LOCTEXT("Metasound_VCFMultimodeNodeCategory", "Utils") };
+
+				return Info;
+			};
+
+		static const FNodeClassMetadata Info = InitNodeInfo();
+
+		return Info;
+	}
+
+	void FVCFMultimodeOperator::BindInputs(FInputVertexInterfaceData& InOutVertexData)
+	{
+		using namespace VCFMultimodeNode;
+
+		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InParamNameAudioInput), AudioInput);
+		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InParamNameVCFCutoff), mInVCFCutoff);
+		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InParamNameVCFQ), mInVCFQ);
+		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InParamNameUpdateRate), mUpdateRate);
+		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InParamNameTanTable), mUseTanTable);
+	}
+
+	void FVCFMultimodeOperator::BindOutputs(FOutputVertexInterfaceData& InOutVertexData)
+	{
+		using namespace VCFMultimodeNode;
+
+		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(OutParamNameLowPass), LowPassOutput);
+		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(OutParamNameBandPass), BandPassOutput);
+		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(OutParamNameHighPass), HighPassOutput);
+		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(OutParamNameNotch), NotchOutput);
+		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(OutParamNamePeak), PeakOutput);
+	}
+
+	const FVertexInterface& FVCFMultimodeOperator::GetVertexInterface()
+	{
+		using namespace VCFMultimodeNode;
+
+		static const FVertexInterface Interface(
+			FInputVertexInterface(
+				TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameAudioInput)),
+				TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameVCFCutoff)),
+				TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameVCFQ)),
+				TInputDataVertex<FEnumVCFUpdateRate>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameUpdateRate), (int32)EVCFUpdateRate::EverySample),
+				TInputDataVertex<bool>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameTanTable), false)
+			),
+
+			FOutputVertexInterface(
+				TOutputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutParamNameLowPass)),
+				TOutputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutParamNameBandPass)),
+				TOutputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutParamNameHighPass)),
+				TOutputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutParamNameNotch)),
+				TOutputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutParamNamePeak))
+			)
+		);
+
+		return Interface;
+	}
+
+	TUniquePtr<IOperator> FVCFMultimodeOperator::CreateOperator(const FBuildOperatorParams& InParams, FBuildResults& OutErrors)
+	{
+		using namespace VCFMultimodeNode;
+
+		const FInputVertexInterfaceData& InputInterface = InParams.InputData;
+
+		FAudioBufferReadRef AudioIn = InputInterface.GetOrCreateDefaultDataReadReference<FAudioBuffer>(METASOUND_GET_PARAM_NAME(InParamNameAudioInput), InParams.OperatorSettings);
+		FAudioBufferReadRef InVCFCutoff = InputInterface.GetOrCreateDefaultDataReadReference<FAudioBuffer>(METASOUND_GET_PARAM_NAME(InParamNameVCFCutoff), InParams.OperatorSettings);
+		FAudioBufferReadRef InVCFQ = InputInterface.GetOrCreateDefaultDataReadReference<FAudioBuffer>(METASOUND_GET_PARAM_NAME(InParamNameVCFQ), InParams.OperatorSettings);
+		FEnumVCFUpdateRateReadRef InUpdateRate = InputInterface.GetOrCreateDefaultDataReadReference<FEnumVCFUpdateRate>(METASOUND_GET_PARAM_NAME(InParamNameUpdateRate), InParams.OperatorSettings);
+		FBoolReadRef InUseTanTable = InputInterface.GetOrCreateDefaultDataReadReference<bool>(METASOUND_GET_PARAM_NAME(InParamNameTanTable), InParams.OperatorSettings);
+
+		return MakeUnique<FVCFMultimodeOperator>(InParams.OperatorSettings, AudioIn, InVCFCutoff, InVCFQ, InUpdateRate, InUseTanTable);
+	}
+
+	void FVCFMultimodeOperator::Execute()
+	{
+		const float* InputAudio = AudioInput->GetData();
+		const float* InputVCFCutoff = mInVCFCutoff->GetData();
+		const float* InputVCFQ = mInVCFQ->GetData();
+
+		const int32 NumSamples = AudioInput->Num();
+
+		mCytomicSVF.SetUpdateRate(ToDSPUpdateRate(*mUpdateRate));
+		mCytomicSVF.SetUseTanTable(*mUseTanTable);
+		mCytomicSVF.ProcessAudioBufferMultimode(InputAudio, InputVCFCutoff, InputVCFQ, LowPassOutput->GetData(), BandPassOutput->GetData(), HighPassOutput->GetData(), NotchOutput->GetData(), PeakOutput->GetData(), NumSamples);
+	}
+
+
+	FNodeClassMetadata FVCFMultimodeNode::CreateNodeClassMetadata()
+	{
+		return FVCFMultimodeOperator::GetNodeInfo();
+	}
+
+	METASOUND_REGISTER_NODE(FVCFMultimodeNode)
+}
+
+#undef LOCTEXT_NAMESPACE
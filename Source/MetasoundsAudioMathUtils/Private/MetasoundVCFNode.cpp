@@ -10,7 +10,14 @@ namespace Metasound
 	DEFINE_METASOUND_ENUM_BEGIN(EVCFFilterType, FEnumVCFFilterType, "VCFFilterType")
 		DEFINE_METASOUND_ENUM_ENTRY(EVCFFilterType::LowPass, "LowPassDescription", "LowPass", "LowPassDescriptionTT", ""),
 		DEFINE_METASOUND_ENUM_ENTRY(EVCFFilterType::BandPass, "BandPassDescriptioin", "BandPass", "BandPassDescriptioinTT", ""),
-		//DEFINE_METASOUND_ENUM_ENTRY(EVCFFilterType::HighPass, "HighPassDescription", "HighPass", "HighPassDescriptionTT", ""),
+		DEFINE_METASOUND_ENUM_ENTRY(EVCFFilterType::HighPass, "HighPassDescription", "HighPass", "HighPassDescriptionTT", ""),
+		DEFINE_METASOUND_ENUM_END()
+
+	DEFINE_METASOUND_ENUM_BEGIN(EVCFUpdateRate, FEnumVCFUpdateRate, "VCFUpdateRate")
+		DEFINE_METASOUND_ENUM_ENTRY(EVCFUpdateRate::EverySample, "EverySampleDescription", "Every Sample", "EverySampleDescriptionTT", "Coefficients follow Cutoff and Q at audio rate."),
+		DEFINE_METASOUND_ENUM_ENTRY(EVCFUpdateRate::Every8, "Every8Description", "Every 8", "Every8DescriptionTT", "Coefficients computed every 8 samples and ramped in between."),
+		DEFINE_METASOUND_ENUM_ENTRY(EVCFUpdateRate::Every16, "Every16Description", "Every 16", "Every16DescriptionTT", "Coefficients computed every 16 samples and ramped in between."),
+		DEFINE_METASOUND_ENUM_ENTRY(EVCFUpdateRate::Every32, "Every32Description", "Every 32", "Every32DescriptionTT", "Coefficients computed every 32 samples and ramped in between."),
 		DEFINE_METASOUND_ENUM_END()
 
 	namespace VCFNode
@@ -20,6 +27,8 @@ namespace Metasound
 			METASOUND_PARAM(InParamNameVCFCutoff, "Cutoff Hz", "Cutoff freq in Hz")
 			METASOUND_PARAM(InParamNameVCFQ, "Q", "Q of 0.707 means no resonant peaking")
 			METASOUND_PARAM(InParamNameVCOFilterType, "FilterType", "The type of filter to apply")
+			METASOUND_PARAM(InParamNameUpdateRate, "Update Rate", "How often Cutoff and Q are read. Slower rates are cheaper when modulating, a constant Cutoff and Q is always cheap.")
+			METASOUND_PARAM(InParamNameTanTable, "Tan Table", "Cutoff to coefficient through a shared tan table instead of the rational approximation. Cheaper for static and control rate cutoffs, ~4e-5 relative error near nyquist.")
 
 			// Output params
 			METASOUND_PARAM(OutParamNameAudio, "Out", "Audio output.")
@@ -28,13 +37,17 @@ namespace Metasound
 	//------------------------------------------------------------------------------------
 	// FVCFOperator
 	//------------------------------------------------------------------------------------
-	FVCFOperator::FVCFOperator(const FOperatorSettings& InSettings, const FAudioBufferReadRef& InAudioInput, const FAudioBufferReadRef& InVCFCutoff, const FAudioBufferReadRef& InVCFQ, FEnumVCFFilterTypeReadRef& filterType)
+	FVCFOperator::FVCFOperator(const FOperatorSettings& InSettings, const FAudioBufferReadRef& InAudioInput, const FAudioBufferReadRef& InVCFCutoff, const FAudioBufferReadRef& InVCFQ, FEnumVCFFilterTypeReadRef& filterType, const FEnumVCFUpdateRateReadRef& InUpdateRate, const FBoolReadRef& InUseTanTable)
 		: AudioInput(InAudioInput)
 		, AudioOutput(FAudioBufferWriteRef::CreateNew(InSettings))
 		, mInVCFCutoff(InVCFCutoff)
 		, mInVCFQ(InVCFQ)
 		, mFilterType(filterType)
+		, mUpdateRate(InUpdateRate)
+		, mUseTanTable(InUseTanTable)
 	{
+		mCytomicSVF.SetSampleRate(InSettings.GetSampleRate());
+		mCytomicSVF.SetMaxBlockSize(InSettings.GetNumFramesPerBlock());
 		Init();
 	}
 
@@ -46,9 +59,9 @@ namespace Metasound
 
 				Info.ClassName = { TEXT("UE"), TEXT("VCF (Audio)"), TEXT("Audio") };
 				Info.MajorVersion = 1;
-				Info.MinorVersion = 0;
+				Info.MinorVersion = 3;
 				Info.DisplayName = LOCTEXT("Metasound_VCFDisplayName", "VCF (Audio)");
-				Info.Description = LOCTEXT("Metasound_VCFNodeDescription", "Filter that can modulate up to nyquist: 2 pole, 12dB / 8ve. From http://cytomic.com/files/dsp/SvfLinearTrapOptimised2.pdf, not high pass is currently bugged!");
+				Info.Description = LOCTEXT("Metasound_VCFNodeDescription", "Filter that can modulate up to nyquist: 2 pole, 12dB / 8ve. From http://cytomic.com/files/dsp/SvfLinearTrapOptimised2.pdf. Use VCF Multimode for several responses from one filter.");
 				Info.Author = "Chris Wratt";
 				Info.PromptIfMissing = PluginNodeMissingPrompt;
 				Info.DefaultInterface = GetVertexInterface();
@@ -70,6 +83,8 @@ namespace Metasound
 		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InParamNameVCFCutoff), mInVCFCutoff);
 		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InParamNameVCFQ), mInVCFQ);
 		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InParamNameVCOFilterType), mFilterType);
+		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InParamNameUpdateRate), mUpdateRate);
+		InOutVertexData.BindReadVertex(METASOUND_GET_PARAM_NAME(InParamNameTanTable), mUseTanTable);
 	}
 
 	void FVCFOperator::BindOutputs(FOutputVertexInterfaceData& InOutVertexData)
@@ -88,7 +103,9 @@ namespace Metasound
 				TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameAudioInput)),
 				TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameVCFCutoff)),
 				TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameVCFQ)),
-				TInputDataVertex<FEnumVCFFilterType>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameVCOFilterType), (int32)EVCFFilterType::LowPass)
+				TInputDataVertex<FEnumVCFFilterType>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameVCOFilterType), (int32)EVCFFilterType::LowPass),
+				TInputDataVertex<FEnumVCFUpdateRate>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameUpdateRate), (int32)EVCFUpdateRate::EverySample),
+				TInputDataVertex<bool>(METASOUND_GET_PARAM_NAME_AND_METADATA(InParamNameTanTable), false)
 			),
 
 			FOutputVertexInterface(
@@ -109,9 +126,11 @@ namespace Metasound
 		FAudioBufferReadRef InVCFCutoff = InputInterface.GetOrCreateDefaultDataReadReference<FAudioBuffer>(METASOUND_GET_PARAM_NAME(InParamNameVCFCutoff), InParams.OperatorSettings);
 		FAudioBufferReadRef InVCFQ = InputInterface.GetOrCreateDefaultDataReadReference<FAudioBuffer>(METASOUND_GET_PARAM_NAME(InParamNameVCFQ), InParams.OperatorSettings);
 		FEnumVCFFilterTypeReadRef InFilterType = InputInterface.GetOrCreateDefaultDataReadReference<FEnumVCFFilterType>(METASOUND_GET_PARAM_NAME(InParamNameVCOFilterType), InParams.OperatorSettings);
+		FEnumVCFUpdateRateReadRef InUpdateRate = InputInterface.GetOrCreateDefaultDataReadReference<FEnumVCFUpdateRate>(METASOUND_GET_PARAM_NAME(InParamNameUpdateRate), InParams.OperatorSettings);
+		FBoolReadRef InUseTanTable = InputInterface.GetOrCreateDefaultDataReadReference<bool>(METASOUND_GET_PARAM_NAME(InParamNameTanTable), InParams.OperatorSettings);
 
 
-		return MakeUnique<FVCFOperator>(InParams.OperatorSettings, AudioIn, InVCFCutoff, InVCFQ, InFilterType);
+		return MakeUnique<FVCFOperator>(InParams.OperatorSettings, AudioIn, InVCFCutoff, InVCFQ, InFilterType, InUpdateRate, InUseTanTable);
 	}
 
 	void FVCFOperator::Execute()
@@ -123,6 +142,8 @@ namespace Metasound
 
 		const int32 NumSamples = AudioInput->Num();
 
+		mCytomicSVF.SetUpdateRate(ToDSPUpdateRate(*mUpdateRate));
+		mCytomicSVF.SetUseTanTable(*mUseTanTable);
 		mCytomicSVF.ProcessAudioBuffer(InputAudio, OutputAudio, InputVCFCutoff, InputVCFQ, NumSamples);
 	}
 
@@ -139,9 +160,9 @@ namespace Metasound
 			mCytomicSVF.setBP();
 			break;
 
-		//case EVCFFilterType::HighPass:
-		//	mCytomicSVF.setHPF();
-		//	break;
+		case EVCFFilterType::HighPass:
+			mCytomicSVF.setHPF();
+			break;
 		}
 	}
 
@@ -0,0 +1,1315 @@
+// Copyright Christopher Wratt 2024.
+// All code under MIT license: see https://mit-license.org/
+
+// Developer console commands for measuring the DSPProcessing kernels in a running editor or game.
+
+#include "CoreMinimal.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "AudioUtils.h"
+#include "CytomicSVF.h"
+#include "Oversampler.h"
+#include "DSP/Dsp.h"
+
+// The standalone build under Tools/Bench has the kernels but no MetaSound graph, and leaves the operator cases out
+#ifndef METASOUNDSAUDIOMATHUTILS_WITH_OPERATORS
+#define METASOUNDSAUDIOMATHUTILS_WITH_OPERATORS 1
+#endif
+
+#if METASOUNDSAUDIOMATHUTILS_WITH_OPERATORS
+#include "MetasoundAudioMathUtilsEnums.h"
+#include "MetasoundAudioDivideNode.h"
+#include "MetasoundOnePoleIIRNode.h"
+#include "MetasoundPowNode.h"
+#include "MetasoundReflectNode.h"
+#include "MetasoundVCFNode.h"
+#include "MetasoundWrapNode.h"
+#endif
+
+#if PLATFORM_LINUX
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#if !UE_BUILD_SHIPPING
+
+namespace MetasoundsAudioMathUtilsBenchmarks
+{
+	// Best of InNumRuns, in ns per sample
+	template<typename FuncType>
+	double TimeNsPerSample(const int32 InNumSamples, const int32 InNumRuns, FuncType InFunc)
+	{
+		double Best = TNumericLimits<double>::Max();
+		for (int32 Run = 0; Run < InNumRuns; ++Run)
+		{
+			const double Start = FPlatformTime::Seconds();
+			InFunc();
+			Best = FMath::Min(Best, FPlatformTime::Seconds() - Start);
+		}
+
+		return Best * 1.0e9 / (double)InNumSamples;
+	}
+
+	void BenchmarkTan(FOutputDevice& Ar)
+	{
+		constexpr int32 NumSamples = 4096;
+		constexpr int32 NumRuns = 200;
+		constexpr float SampleRate = 48000.0f;
+		const float MaxCutoff = DSPProcessing::FSVFTanTable::MaxNormalizedCutoff * SampleRate;
+		const DSPProcessing::FSVFTanTable& TanTable = DSPProcessing::FSVFTanTable::Get();
+
+		// max relative error against double tan, below fs/4 and up to the top of the table
+		double FastTanError[2] = { 0.0, 0.0 };
+		double TableError[2] = { 0.0, 0.0 };
+		double FloatTanError[2] = { 0.0, 0.0 };
+		for (int32 Step = 1; Step <= 100000; ++Step)
+		{
+			const float Cutoff = MaxCutoff * (float)Step / 100000.0f;
+			const double Exact = FMath::Tan(UE_DOUBLE_PI * (double)Cutoff / (double)SampleRate);
+			const int32 Range = Cutoff < 0.25f * SampleRate ? 0 : 1;
+
+			FastTanError[Range] = FMath::Max(FastTanError[Range], FMath::Abs(Audio::FastTan(PI * Cutoff / SampleRate) - Exact) / Exact);
+			TableError[Range] = FMath::Max(TableError[Range], FMath::Abs(TanTable.Lookup(Cutoff / SampleRate) - Exact) / Exact);
+			FloatTanError[Range] = FMath::Max(FloatTanError[Range], FMath::Abs(FMath::Tan(PI * Cutoff / SampleRate) - Exact) / Exact);
+		}
+
+		TArray<float> Cutoffs;
+		TArray<float> G;
+		Cutoffs.SetNumUninitialized(NumSamples);
+		G.SetNumUninitialized(NumSamples);
+		for (int32 Index = 0; Index < NumSamples; ++Index)
+		{
+			Cutoffs[Index] = 20.0f + (MaxCutoff - 20.0f) * (float)Index / (float)NumSamples;
+		}
+
+		const float* CutoffData = Cutoffs.GetData();
+		float* GData = G.GetData();
+
+		const double FastTanTime = TimeNsPerSample(NumSamples, NumRuns, [&]()
+			{
+				for (int32 Index = 0; Index < NumSamples; ++Index)
+				{
+					GData[Index] = Audio::FastTan(PI * CutoffData[Index] / SampleRate);
+				}
+			});
+		const double TableTime = TimeNsPerSample(NumSamples, NumRuns, [&]()
+			{
+				TanTable.ProcessBuffer(CutoffData, 1.0f / SampleRate, GData, NumSamples);
+			});
+		const double FloatTanTime = TimeNsPerSample(NumSamples, NumRuns, [&]()
+			{
+				for (int32 Index = 0; Index < NumSamples; ++Index)
+				{
+					GData[Index] = FMath::Tan(PI * CutoffData[Index] / SampleRate);
+				}
+			});
+
+		Ar.Logf(TEXT("cutoff -> g, %d samples, best of %d runs. Max relative error below fs/4 | up to %.2f fs"), NumSamples, NumRuns, DSPProcessing::FSVFTanTable::MaxNormalizedCutoff);
+		Ar.Logf(TEXT("  Audio::FastTan  %6.3f ns/sample  %.2e | %.2e"), FastTanTime, FastTanError[0], FastTanError[1]);
+		Ar.Logf(TEXT("  FSVFTanTable    %6.3f ns/sample  %.2e | %.2e"), TableTime, TableError[0], TableError[1]);
+		Ar.Logf(TEXT("  FMath::Tan      %6.3f ns/sample  %.2e | %.2e"), FloatTanTime, FloatTanError[0], FloatTanError[1]);
+	}
+
+	constexpr int32 MinBlockSize = 32;
+	constexpr int32 MaxBlockSize = 4096;
+	constexpr float BenchmarkSampleRate = 48000.0f;
+
+	// Inputs and outputs for one kernel case, with one float of slack so a block can start one float
+	// past the allocation's alignment
+	struct FKernelBuffers
+	{
+		static constexpr int32 NumInputs = 4;
+		static constexpr int32 NumOutputs = 5;
+
+		TArray<float> Inputs[NumInputs];
+		TArray<float> Outputs[NumOutputs];
+
+		FKernelBuffers()
+		{
+			for (TArray<float>& Input : Inputs)
+			{
+				Input.SetNumZeroed(MaxBlockSize + 1);
+			}
+			for (TArray<float>& Output : Outputs)
+			{
+				Output.SetNumZeroed(MaxBlockSize + 1);
+			}
+		}
+
+		const float* In(const int32 InIndex, const int32 InOffset) const { return Inputs[InIndex].GetData() + InOffset; }
+		float* Out(const int32 InIndex, const int32 InOffset) { return Outputs[InIndex].GetData() + InOffset; }
+	};
+
+	// Input shapes the nodes see in practice, all seeded so runs compare between builds
+
+	// A few inharmonic partials plus a little noise, peaking near InGain
+	void FillAudio(TArray<float>& OutBuffer, const float InGain, const int32 InSeed = 1)
+	{
+		FRandomStream Random(InSeed);
+		for (int32 Index = 0; Index < OutBuffer.Num(); ++Index)
+		{
+			const float Time = (float)Index / BenchmarkSampleRate;
+			const float Partials = 0.5f * FMath::Sin(2.0f * PI * 110.0f * Time) + 0.25f * FMath::Sin(2.0f * PI * 347.0f * Time) + 0.15f * FMath::Sin(2.0f * PI * 2719.0f * Time);
+			OutBuffer[Index] = InGain * (Partials + 0.05f * Random.FRandRange(-1.0f, 1.0f));
+		}
+	}
+
+	void FillPhasor(TArray<float>& OutBuffer, const float InFrequency)
+	{
+		for (int32 Index = 0; Index < OutBuffer.Num(); ++Index)
+		{
+			OutBuffer[Index] = FMath::Frac(InFrequency * (float)Index / BenchmarkSampleRate);
+		}
+	}
+
+	// Slow sine sweep between InMin and InMax, a modulated control input
+	void FillSweep(TArray<float>& OutBuffer, const float InMin, const float InMax, const float InFrequency)
+	{
+		for (int32 Index = 0; Index < OutBuffer.Num(); ++Index)
+		{
+			const float Position = 0.5f + 0.5f * FMath::Sin(2.0f * PI * InFrequency * (float)Index / BenchmarkSampleRate);
+			OutBuffer[Index] = InMin + (InMax - InMin) * Position;
+		}
+	}
+
+	void FillConstant(TArray<float>& OutBuffer, const float InValue)
+	{
+		for (float& Sample : OutBuffer)
+		{
+			Sample = InValue;
+		}
+	}
+
+	// Alternating runs of 1 and 0, InRunLength samples each
+	void FillGate(TArray<float>& OutBuffer, const int32 InRunLength)
+	{
+		for (int32 Index = 0; Index < OutBuffer.Num(); ++Index)
+		{
+			OutBuffer[Index] = (Index / InRunLength) % 2 == 0 ? 1.0f : 0.0f;
+		}
+	}
+
+	// One of each kernel, set up the way the nodes use them
+	struct FKernelInstances
+	{
+		DSPProcessing::FSine SinePolynomial;
+		DSPProcessing::FSine SineLinear;
+		DSPProcessing::FSine SineCubic;
+		DSPProcessing::FCos Cos;
+		DSPProcessing::FSinCos SinCos;
+		DSPProcessing::FPow Pow;
+		DSPProcessing::FPowADAA PowADAA;
+		DSPProcessing::FSqrt SqrtPrecise;
+		DSPProcessing::FSqrt SqrtFast;
+		DSPProcessing::FWrap Wrap;
+		DSPProcessing::FWrapADAA WrapADAA;
+		DSPProcessing::TOversampled<DSPProcessing::FWrap, 2> Wrap2x;
+		DSPProcessing::TOversampled<DSPProcessing::FWrap, 4> Wrap4x;
+		DSPProcessing::FReflect Reflect;
+		DSPProcessing::FReflectADAA ReflectADAA;
+		DSPProcessing::FAudioDivide DividePrecise;
+		DSPProcessing::FAudioDivide DivideFast;
+		DSPProcessing::FGate Gate;
+		DSPProcessing::FOnePoleIIR OnePoleIIR;
+		DSPProcessing::FOnePoleFIR OnePoleFIR;
+		DSPProcessing::FRZero RZero;
+		DSPProcessing::FSamphold Samphold;
+		DSPProcessing::CytomicSVF SVF;
+		DSPProcessing::CytomicSVF SVFControlRate;
+		DSPProcessing::CytomicSVF SVFMultimode;
+		DSPProcessing::FCytomicSVFBank SVFBank;
+		float RZeroPrior = 0.0f;
+
+		FKernelInstances()
+		{
+			SineLinear.SetMode(DSPProcessing::ESineMode::WavetableLinear, DSPProcessing::ESineTableSize::Size2048);
+			SineCubic.SetMode(DSPProcessing::ESineMode::WavetableCubic, DSPProcessing::ESineTableSize::Size2048);
+			SqrtFast.SetAccuracy(DSPProcessing::EAccuracy::Fast);
+			DivideFast.SetAccuracy(DSPProcessing::EAccuracy::Fast);
+			Wrap2x.SetMaxBlockSize(MaxBlockSize);
+			Wrap4x.SetMaxBlockSize(MaxBlockSize);
+
+			DSPProcessing::CytomicSVF* Filters[] = { &SVF, &SVFControlRate, &SVFMultimode };
+			for (DSPProcessing::CytomicSVF* Filter : Filters)
+			{
+				Filter->SetSampleRate(BenchmarkSampleRate);
+				Filter->SetMaxBlockSize(MaxBlockSize);
+				Filter->SetLPF();
+			}
+			SVFControlRate.SetUpdateRate(DSPProcessing::ESVFUpdateRate::Every16);
+
+			// a 16 band vocoder style bank
+			SVFBank.SetSampleRate(BenchmarkSampleRate);
+			SVFBank.SetNumFilters(16);
+			SVFBank.SetBP();
+			for (int32 Filter = 0; Filter < 16; ++Filter)
+			{
+				SVFBank.SetFilter(Filter, 100.0f * FMath::Pow(1.3f, (float)Filter), 8.0f, 1.0f);
+			}
+		}
+	};
+
+	struct FKernelCase
+	{
+		const TCHAR* Name;
+		// fills the whole of every buffer the case reads
+		void (*Fill)(FKernelBuffers& OutBuffers);
+		// one block starting InOffset floats into the buffers
+		void (*Process)(FKernelInstances& InKernels, FKernelBuffers& InBuffers, const int32 InOffset, const int32 InNumSamples);
+	};
+
+	static const FKernelCase KernelCases[] =
+	{
+		{ TEXT("Sine Polynomial"),
+			[](FKernelBuffers& B) { FillPhasor(B.Inputs[0], 440.0f); },
+			[](FKernelInstances& K, FKernelBuffers& B, const int32 O, const int32 N) { K.SinePolynomial.ProcessAudioBuffer(B.In(0, O), B.Out(0, O), N); } },
+		{ TEXT("Sine WavetableLinear"),
+			[](FKernelBuffers& B) { FillPhasor(B.Inputs[0], 440.0f); },
+			[](FKernelInstances& K, FKernelBuffers& B, const int32 O, const int32 N) { K.SineLinear.ProcessAudioBuffer(B.In(0, O), B.Out(0, O), N); } },
+		{ TEXT("Sine WavetableCubic"),
+			[](FKernelBuffers& B) { FillPhasor(B.Inputs[0], 440.0f); },
+			[](FKernelInstances& K, FKernelBuffers& B, const int32 O, const int32 N) { K.SineCubic.ProcessAudioBuffer(B.In(0, O), B.Out(0, O), N); } },
+		{ TEXT("Cos Polynomial"),
+			[](FKernelBuffers& B) { FillPhasor(B.Inputs[0], 440.0f); },
+			[](FKernelInstances& K, FKernelBuffers& B, const int32 O, const int32 N) { K.Cos.ProcessAudioBuffer(B.In(0, O), B.Out(0, O), N); } },
+		{ TEXT("SinCos"),
+			[](FKernelBuffers& B) { FillPhasor(B.Inputs[0], 440.0f); },
+			[](FKernelInstances& K, FKernelBuffers& B, const int32 O, const int32 N) { K.SinCos.ProcessAudioBuffer(B.In(0, O), B.Out(0, O), B.Out(1, O), N); } },
+		{ TEXT("Pow Constant 2.5"),
+			[](FKernelBuffers& B) { FillAudio(B.Inputs[0], 1.0f); FillConstant(B.Inputs[1], 2.5f); },
+			[](FKernelInstances& K, FKernelBuffers& B, const int32 O, const int32 N) { K.Pow.ProcessAudioBuffer(B.In(0, O), B.Out(0, O), B.In(1, O), N); } },
+		{ TEXT("Pow Constant 2"),
+			[](FKernelBuffers& B) { FillAudio(B.Inputs[0], 1.0f); FillConstant(B.Inputs[1], 2.0f); },
+			[](FKernelInstances& K, FKernelBuffers& B, const int32 O, const int32 N) { K.Pow.ProcessAudioBuffer(B.In(0, O), B.Out(0, O), B.In(1, O), N); } },
+		{ TEXT("Pow Modulated"),
+			[](FKernelBuffers& B) { FillAudio(B.Inputs[0], 1.0f); FillSweep(B.Inputs[1], 0.5f, 3.0f, 2.0f); },
+			[](FKernelInstances& K, FKernelBuffers& B, const int32 O, const int32 N) { K.Pow.ProcessAudioBuffer(B.In(0, O), B.Out(0, O), B.In(1, O), N); } },
+		{ TEXT("Pow ADAA Constant 2.5"),
+			[](FKernelBuffers& B) { FillAudio(B.Inputs[0], 1.0f); FillConstant(B.Inputs[1], 2.5f); },
+			[](FKernelInstances& K, FKernelBuffers& B, const int32 O, const int32 N) { K.PowADAA.ProcessAudioBuffer(B.In(0, O), B.Out(0, O), B.In(1, O), N); } },
+		{ TEXT("Sqrt Precise"),
+			[](FKernelBuffers& B) { FillAudio(B.Inputs[0], 1.0f); },
+			[](FKernelInstances& K, FKernelBuffers& B, const int32 O, const int32 N) { K.SqrtPrecise.ProcessAudioBuffer(B.In(0, O), B.Out(0, O), N); } },
+		{ TEXT("Sqrt Fast"),
+			[](FKernelBuffers& B) { FillAudio(B.Inputs[0], 1.0f); },
+			[](FKernelInstances& K, FKernelBuffers& B, const int32 O, const int32 N) { K.SqrtFast.ProcessAudioBuffer(B.In(0, O), B.Out(0, O), N); } },
+		{ TEXT("Wrap"),
+			[](FKernelBuffers& B) { FillAudio(B.Inputs[0], 4.0f); },
+			[](FKernelInstances& K, FKernelBuffers& B, const int32 O, const int32 N) { K.Wrap.ProcessAudioBuffer(B.In(0, O), B.Out(0, O), N); } },
+		{ TEXT("Wrap ADAA"),
+			[](FKernelBuffers& B) { FillAudio(B.Inputs[0], 4.0f); },
+			[](FKernelInstances& K, FKernelBuffers& B, const int32 O, const int32 N) { K.WrapADAA.ProcessAudioBuffer(B.In(0, O), B.Out(0, O), N); } },
+		{ TEXT("Wrap Oversample 2x"),
+			[](FKernelBuffers& B) { FillAudio(B.Inputs[0], 4.0f); },
+			[](FKernelInstances& K, FKernelBuffers& B, const int32 O, const int32 N) { K.Wrap2x.ProcessAudioBuffer(B.In(0, O), B.Out(0, O), N); } },
+		{ TEXT("Wrap Oversample 4x"),
+			[](FKernelBuffers& B) { FillAudio(B.Inputs[0], 4.0f); },
+			[](FKernelInstances& K, FKernelBuffers& B, const int32 O, const int32 N) { K.Wrap4x.ProcessAudioBuffer(B.In(0, O), B.Out(0, O), N); } },
+		{ TEXT("Reflect"),
+			[](FKernelBuffers& B) { FillAudio(B.Inputs[0], 4.0f); },
+			[](FKernelInstances& K, FKernelBuffers& B, const int32 O, const int32 N) { K.Reflect.ProcessAudioBuffer(B.In(0, O), B.Out(0, O), N); } },
+		{ TEXT("Reflect ADAA"),
+			[](FKernelBuffers& B) { FillAudio(B.Inputs[0], 4.0f); },
+			[](FKernelInstances& K, FKernelBuffers& B, const int32 O, const int32 N) { K.ReflectADAA.ProcessAudioBuffer(B.In(0, O), B.Out(0, O), N); } },
+		{ TEXT("AudioDivide Precise"),
+			[](FKernelBuffers& B) { FillAudio(B.Inputs[0], 1.0f); FillAudio(B.Inputs[1], 1.0f, 2); },
+			[](FKernelInstances& K, FKernelBuffers& B, const int32 O, const int32 N) { K.DividePrecise.ProcessAudioBuffer(B.In(0, O), B.Out(0, O), B.In(1, O), N); } },
+		{ TEXT("AudioDivide Fast"),
+			[](FKernelBuffers& B) { FillAudio(B.Inputs[0], 1.0f); FillAudio(B.Inputs[1], 1.0f, 2); },
+			[](FKernelInstances& K, FKernelBuffers& B, const int32 O, const int32 N) { K.DivideFast.ProcessAudioBuffer(B.In(0, O), B.Out(0, O), B.In(1, O), N); } },
+		{ TEXT("Compare LessThan"),
+			[](FKernelBuffers& B) { FillAudio(B.Inputs[0], 1.0f); FillAudio(B.Inputs[1], 1.0f, 2); },
+			[](FKernelInstances& /*K*/, FKernelBuffers& B, const int32 O, const int32 N) { DSPProcessing::FCompare::ProcessAudioBuffer(DSPProcessing::EComparison::LessThan, B.In(0, O), B.In(1, O), B.Out(0, O), N); } },
+		{ TEXT("Select LessThan"),
+			[](FKernelBuffers& B) { FillAudio(B.Inputs[0], 1.0f); FillAudio(B.Inputs[1], 1.0f, 2); FillAudio(B.Inputs[2], 1.0f, 3); FillAudio(B.Inputs[3], 1.0f, 4); },
+			[](FKernelInstances& /*K*/, FKernelBuffers& B, const int32 O, const int32 N) { DSPProcessing::FSelect::ProcessAudioBuffer(DSPProcessing::EComparison::LessThan, B.In(0, O), B.In(1, O), B.In(2, O), B.In(3, O), B.Out(0, O), N); } },
+		{ TEXT("Gate"),
+			[](FKernelBuffers& B) { FillAudio(B.Inputs[0], 1.0f); FillGate(B.Inputs[1], 1000); },
+			[](FKernelInstances& K, FKernelBuffers& B, const int32 O, const int32 N) { K.Gate.ProcessAudioBuffer(B.In(0, O), B.Out(0, O), B.In(1, O), N); } },
+		{ TEXT("OnePoleIIR Constant"),
+			[](FKernelBuffers& B) { FillAudio(B.Inputs[0], 1.0f); FillConstant(B.Inputs[1], 0.99f); FillConstant(B.Inputs[2], 0.01f); },
+			[](FKernelInstances& K, FKernelBuffers& B, const int32 O, const int32 N) { K.OnePoleIIR.ProcessAudioBuffer(B.In(0, O), B.Out(0, O), B.In(1, O), B.In(2, O), N); } },
+		{ TEXT("OnePoleIIR Modulated"),
+			[](FKernelBuffers& B) { FillAudio(B.Inputs[0], 1.0f); FillSweep(B.Inputs[1], 0.9f, 0.999f, 3.0f); FillSweep(B.Inputs[2], 0.1f, 0.001f, 3.0f); },
+			[](FKernelInstances& K, FKernelBuffers& B, const int32 O, const int32 N) { K.OnePoleIIR.ProcessAudioBuffer(B.In(0, O), B.Out(0, O), B.In(1, O), B.In(2, O), N); } },
+		{ TEXT("OnePoleFIR Constant"),
+			[](FKernelBuffers& B) { FillAudio(B.Inputs[0], 1.0f); FillConstant(B.Inputs[1], 0.5f); FillConstant(B.Inputs[2], 0.5f); },
+			[](FKernelInstances& K, FKernelBuffers& B, const int32 O, const int32 N) { K.OnePoleFIR.ProcessAudioBuffer(B.In(0, O), B.Out(0, O), B.In(1, O), B.In(2, O), N); } },
+		{ TEXT("OnePoleFIR Modulated"),
+			[](FKernelBuffers& B) { FillAudio(B.Inputs[0], 1.0f); FillSweep(B.Inputs[1], 0.0f, 1.0f, 3.0f); FillSweep(B.Inputs[2], 1.0f, 0.0f, 3.0f); },
+			[](FKernelInstances& K, FKernelBuffers& B, const int32 O, const int32 N) { K.OnePoleFIR.ProcessAudioBuffer(B.In(0, O), B.Out(0, O), B.In(1, O), B.In(2, O), N); } },
+		{ TEXT("RZero"),
+			[](FKernelBuffers& B) { FillAudio(B.Inputs[0], 1.0f); },
+			[](FKernelInstances& K, FKernelBuffers& B, const int32 O, const int32 N) { K.RZeroPrior = K.RZero.ProcessAudioBuffer(B.In(0, O), B.Out(0, O), 0.95f, K.RZeroPrior, N); } },
+		{ TEXT("Samphold"),
+			[](FKernelBuffers& B) { FillAudio(B.Inputs[0], 1.0f); FillPhasor(B.Inputs[1], 100.0f); },
+			[](FKernelInstances& K, FKernelBuffers& B, const int32 O, const int32 N) { K.Samphold.ProcessAudioBuffer(B.In(0, O), B.Out(0, O), B.In(1, O), N); } },
+		{ TEXT("VCF Static"),
+			[](FKernelBuffers& B) { FillAudio(B.Inputs[0], 1.0f); FillConstant(B.Inputs[1], 1000.0f); FillConstant(B.Inputs[2], 2.0f); },
+			[](FKernelInstances& K, FKernelBuffers& B, const int32 O, const int32 N) { K.SVF.ProcessAudioBuffer(B.In(0, O), B.Out(0, O), B.In(1, O), B.In(2, O), N); } },
+		{ TEXT("VCF Modulated"),
+			[](FKernelBuffers& B) { FillAudio(B.Inputs[0], 1.0f); FillSweep(B.Inputs[1], 200.0f, 8000.0f, 0.5f); FillSweep(B.Inputs[2], 0.7f, 5.0f, 0.3f); },
+			[](FKernelInstances& K, FKernelBuffers& B, const int32 O, const int32 N) { K.SVF.ProcessAudioBuffer(B.In(0, O), B.Out(0, O), B.In(1, O), B.In(2, O), N); } },
+		{ TEXT("VCF Modulated Every16"),
+			[](FKernelBuffers& B) { FillAudio(B.Inputs[0], 1.0f); FillSweep(B.Inputs[1], 200.0f, 8000.0f, 0.5f); FillSweep(B.Inputs[2], 0.7f, 5.0f, 0.3f); },
+			[](FKernelInstances& K, FKernelBuffers& B, const int32 O, const int32 N) { K.SVFControlRate.ProcessAudioBuffer(B.In(0, O), B.Out(0, O), B.In(1, O), B.In(2, O), N); } },
+		{ TEXT("VCF Multimode Modulated"),
+			[](FKernelBuffers& B) { FillAudio(B.Inputs[0], 1.0f); FillSweep(B.Inputs[1], 200.0f, 8000.0f, 0.5f); FillSweep(B.Inputs[2], 0.7f, 5.0f, 0.3f); },
+			[](FKernelInstances& K, FKernelBuffers& B, const int32 O, const int32 N) { K.SVFMultimode.ProcessAudioBufferMultimode(B.In(0, O), B.In(1, O), B.In(2, O), B.Out(0, O), B.Out(1, O), B.Out(2, O), B.Out(3, O), B.Out(4, O), N); } },
+		{ TEXT("VCF Bank 16"),
+			[](FKernelBuffers& B) { FillAudio(B.Inputs[0], 1.0f); },
+			[](FKernelInstances& K, FKernelBuffers& B, const int32 O, const int32 N) { K.SVFBank.ProcessAudioBuffer(B.In(0, O), B.Out(0, O), N); } },
+	};
+
+	// Hardware counters for the calling thread, opened as one perf_event_open group so every counter covers the
+	// same instructions. User space only, which perf_event_paranoid 2 still allows. Linux only, and counters the
+	// CPU or hypervisor doesn't expose read as unavailable.
+	class FHardwareCounters
+	{
+	public:
+		enum ECounter
+		{
+			Cycles,
+			Instructions,
+			L1DMisses,
+			LLCMisses,
+			BranchMisses,
+			NumCounters
+		};
+
+		FHardwareCounters()
+		{
+			for (int32& Descriptor : Descriptors)
+			{
+				Descriptor = -1;
+			}
+
+#if PLATFORM_LINUX
+			constexpr uint64 ReadMiss = (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+			const uint32 Types[NumCounters] = { PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE, PERF_TYPE_HW_CACHE, PERF_TYPE_HW_CACHE, PERF_TYPE_HARDWARE };
+			const uint64 Configs[NumCounters] = { PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS, PERF_COUNT_HW_CACHE_L1D | ReadMiss, PERF_COUNT_HW_CACHE_LL | ReadMiss, PERF_COUNT_HW_BRANCH_MISSES };
+
+			for (int32 Counter = 0; Counter < NumCounters; ++Counter)
+			{
+				perf_event_attr Attributes;
+				FMemory::Memzero(&Attributes, sizeof(Attributes));
+				Attributes.size = sizeof(Attributes);
+				Attributes.type = Types[Counter];
+				Attributes.config = Configs[Counter];
+				Attributes.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+				Attributes.exclude_kernel = 1;
+				Attributes.exclude_hv = 1;
+				// the members follow the leader, which starts disabled
+				Attributes.disabled = Counter == Cycles ? 1 : 0;
+
+				Descriptors[Counter] = (int32)syscall(SYS_perf_event_open, &Attributes, 0, -1, Counter == Cycles ? -1 : Descriptors[Cycles], 0);
+				if (Descriptors[Cycles] < 0)
+				{
+					break;
+				}
+			}
+#endif
+		}
+
+		~FHardwareCounters()
+		{
+#if PLATFORM_LINUX
+			for (const int32 Descriptor : Descriptors)
+			{
+				if (Descriptor >= 0)
+				{
+					close(Descriptor);
+				}
+			}
+#endif
+		}
+
+		// False when the group couldn't be opened at all
+		bool IsAvailable() const { return Descriptors[Cycles] >= 0; }
+
+		void Start()
+		{
+#if PLATFORM_LINUX
+			if (IsAvailable())
+			{
+				ioctl(Descriptors[Cycles], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+				ioctl(Descriptors[Cycles], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+			}
+#endif
+		}
+
+		// Counts since Start, scaled up if the kernel multiplexed the group. -1 where a counter is unavailable.
+		void Stop(double (&OutCounts)[NumCounters])
+		{
+			for (double& Count : OutCounts)
+			{
+				Count = -1.0;
+			}
+
+#if PLATFORM_LINUX
+			if (!IsAvailable())
+			{
+				return;
+			}
+
+			ioctl(Descriptors[Cycles], PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+
+			// number of events, time enabled, time running, then one value per opened event in the order opened
+			uint64 Values[3 + NumCounters];
+			if (read(Descriptors[Cycles], Values, sizeof(Values)) <= 0 || Values[2] == 0)
+			{
+				return;
+			}
+
+			const double Scale = (double)Values[1] / (double)Values[2];
+			int32 Value = 3;
+			for (int32 Counter = 0; Counter < NumCounters && Value < 3 + (int32)Values[0]; ++Counter)
+			{
+				if (Descriptors[Counter] >= 0)
+				{
+					OutCounts[Counter] = (double)Values[Value++] * Scale;
+				}
+			}
+#endif
+		}
+
+	private:
+		int32 Descriptors[NumCounters];
+	};
+
+	struct FKernelResult
+	{
+		const TCHAR* Name;
+		int32 BlockSize;
+		double NsPerSample[2];
+		// per sample over the aligned runs, -1 where unavailable
+		double Counters[FHardwareCounters::NumCounters];
+
+		double GetIPC() const
+		{
+			return Counters[FHardwareCounters::Cycles] > 0.0 && Counters[FHardwareCounters::Instructions] >= 0.0 ? Counters[FHardwareCounters::Instructions] / Counters[FHardwareCounters::Cycles] : -1.0;
+		}
+	};
+
+	// Column names shared by the CSV header and the JSON keys
+	static const TCHAR* CounterNames[FHardwareCounters::NumCounters] = { TEXT("cycles"), TEXT("instructions"), TEXT("l1d_read_misses"), TEXT("llc_read_misses"), TEXT("branch_misses") };
+
+	// Empty for CSV and null for JSON when unavailable
+	FString FormatCount(const double InValue, const TCHAR* InUnavailable)
+	{
+		return InValue < 0.0 ? FString(InUnavailable) : FString::Printf(TEXT("%.6g"), InValue);
+	}
+
+	FString MakeKernelResultsCSV(const TArray<FKernelResult>& InResults)
+	{
+		FString CSV = TEXT("kernel,block_size,ns_per_sample_aligned,ns_per_sample_misaligned");
+		for (const TCHAR* CounterName : CounterNames)
+		{
+			CSV += FString::Printf(TEXT(",%s_per_sample"), CounterName);
+		}
+		CSV += TEXT(",ipc\n");
+
+		for (const FKernelResult& Result : InResults)
+		{
+			CSV += FString::Printf(TEXT("%s,%d,%.4f,%.4f"), Result.Name, Result.BlockSize, Result.NsPerSample[0], Result.NsPerSample[1]);
+			for (const double Count : Result.Counters)
+			{
+				CSV += TEXT(",") + FormatCount(Count, TEXT(""));
+			}
+			CSV += TEXT(",") + FormatCount(Result.GetIPC(), TEXT("")) + TEXT("\n");
+		}
+		return CSV;
+	}
+
+	FString MakeKernelResultsJSON(const TArray<FKernelResult>& InResults, const int32 InSamplesPerRun, const int32 InNumRuns)
+	{
+		FString JSON = FString::Printf(TEXT("{\n\t\"samples_per_run\": %d,\n\t\"runs\": %d,\n\t\"results\": ["), InSamplesPerRun, InNumRuns);
+		for (int32 Index = 0; Index < InResults.Num(); ++Index)
+		{
+			const FKernelResult& Result = InResults[Index];
+			JSON += FString::Printf(TEXT("%s\n\t\t{ \"kernel\": \"%s\", \"block_size\": %d, \"ns_per_sample_aligned\": %.4f, \"ns_per_sample_misaligned\": %.4f"),
+				Index > 0 ? TEXT(",") : TEXT(""), Result.Name, Result.BlockSize, Result.NsPerSample[0], Result.NsPerSample[1]);
+			for (int32 Counter = 0; Counter < FHardwareCounters::NumCounters; ++Counter)
+			{
+				JSON += FString::Printf(TEXT(", \"%s_per_sample\": "), CounterNames[Counter]) + FormatCount(Result.Counters[Counter], TEXT("null"));
+			}
+			JSON += TEXT(", \"ipc\": ") + FormatCount(Result.GetIPC(), TEXT("null")) + TEXT(" }");
+		}
+		JSON += TEXT("\n\t]\n}\n");
+		return JSON;
+	}
+
+	// Timestamped under Saved/Profiling, so runs from two commits can be diffed
+	void WriteProfilingFile(const TCHAR* InCommand, const TCHAR* InExtension, const FString& InContents, FOutputDevice& Ar)
+	{
+		const FString Path = FPaths::Combine(FPaths::ProfilingDir(), TEXT("MetasoundsAudioMathUtils"), FString::Printf(TEXT("%s-%s.%s"), InCommand, *FDateTime::Now().ToString(), InExtension));
+		Ar.Logf(TEXT("%s %s"), FFileHelper::SaveStringToFile(InContents, *Path) ? TEXT("Wrote") : TEXT("Failed to write"), *Path);
+	}
+
+	// True when there is no filter or InName contains it, ignoring case
+	bool MatchesFilter(const TCHAR* InName, const TCHAR* InFilter)
+	{
+		return InFilter == nullptr || FCString::Stristr(InName, InFilter) != nullptr;
+	}
+
+	void BenchmarkKernels(const TArray<FString>& Args, FOutputDevice& Ar)
+	{
+		// enough blocks per run that small blocks aren't lost in timer resolution
+		constexpr int32 SamplesPerRun = 65536;
+		constexpr int32 NumRuns = 15;
+
+		const TCHAR* Filter = nullptr;
+		bool bCounters = false;
+		bool bWriteCSV = false;
+		bool bWriteJSON = false;
+		for (const FString& Arg : Args)
+		{
+			if (Arg == TEXT("Counters"))
+			{
+				bCounters = true;
+			}
+			else if (Arg == TEXT("CSV"))
+			{
+				bWriteCSV = true;
+			}
+			else if (Arg == TEXT("JSON"))
+			{
+				bWriteJSON = true;
+			}
+			else
+			{
+				Filter = *Arg;
+			}
+		}
+
+		TUniquePtr<FKernelInstances> Kernels = MakeUnique<FKernelInstances>();
+		TUniquePtr<FKernelBuffers> Buffers = MakeUnique<FKernelBuffers>();
+		TUniquePtr<FHardwareCounters> Counters = bCounters ? MakeUnique<FHardwareCounters>() : nullptr;
+		if (Counters && !Counters->IsAvailable())
+		{
+			Ar.Logf(TEXT("Hardware counters unavailable, they need Linux and perf_event_open access."));
+			Counters = nullptr;
+		}
+
+		TArray<FKernelResult> Results;
+
+		Ar.Logf(TEXT("ns/sample and Msamples/s, best of %d runs of %d samples. Misaligned blocks start one float in."), NumRuns, SamplesPerRun);
+		if (Counters)
+		{
+			Ar.Logf(TEXT("Counters per sample over %d more aligned runs, misses per 1000 samples."), NumRuns);
+			Ar.Logf(TEXT("%-26s %5s  %9s %9s  %9s %9s  %7s %7s %5s %7s %7s %7s"), TEXT("Kernel"), TEXT("Block"), TEXT("Aligned"), TEXT("Ms/s"), TEXT("Misalign"), TEXT("Ms/s"),
+				TEXT("Cycles"), TEXT("Instr"), TEXT("IPC"), TEXT("L1D"), TEXT("LLC"), TEXT("Branch"));
+		}
+		else
+		{
+			Ar.Logf(TEXT("%-26s %5s  %9s %9s  %9s %9s"), TEXT("Kernel"), TEXT("Block"), TEXT("Aligned"), TEXT("Ms/s"), TEXT("Misalign"), TEXT("Ms/s"));
+		}
+
+		for (const FKernelCase& Case : KernelCases)
+		{
+			if (!MatchesFilter(Case.Name, Filter))
+			{
+				continue;
+			}
+
+			Case.Fill(*Buffers);
+
+			for (int32 BlockSize = MinBlockSize; BlockSize <= MaxBlockSize; BlockSize *= 2)
+			{
+				const int32 NumBlocks = FMath::Max(1, SamplesPerRun / BlockSize);
+				FKernelResult& Result = Results.AddDefaulted_GetRef();
+				Result.Name = Case.Name;
+				Result.BlockSize = BlockSize;
+				for (int32 Offset = 0; Offset < 2; ++Offset)
+				{
+					Result.NsPerSample[Offset] = TimeNsPerSample(NumBlocks * BlockSize, NumRuns, [&]()
+						{
+							for (int32 Block = 0; Block < NumBlocks; ++Block)
+							{
+								Case.Process(*Kernels, *Buffers, Offset, BlockSize);
+							}
+						});
+				}
+
+				for (double& Count : Result.Counters)
+				{
+					Count = -1.0;
+				}
+				if (Counters)
+				{
+					// counted separately so the ioctls stay out of the timing
+					Counters->Start();
+					for (int32 Run = 0; Run < NumRuns; ++Run)
+					{
+						for (int32 Block = 0; Block < NumBlocks; ++Block)
+						{
+							Case.Process(*Kernels, *Buffers, 0, BlockSize);
+						}
+					}
+					Counters->Stop(Result.Counters);
+
+					const double NumSamples = (double)NumRuns * (double)NumBlocks * (double)BlockSize;
+					for (double& Count : Result.Counters)
+					{
+						Count = Count < 0.0 ? Count : Count / NumSamples;
+					}
+
+					const auto Format = [](const double InCount, const double InScale) { return InCount < 0.0 ? FString(TEXT("n/a")) : FString::Printf(TEXT("%.2f"), InScale * InCount); };
+					Ar.Logf(TEXT("%-26s %5d  %9.3f %9.1f  %9.3f %9.1f  %7s %7s %5s %7s %7s %7s"), Case.Name, BlockSize, Result.NsPerSample[0], 1000.0 / Result.NsPerSample[0], Result.NsPerSample[1], 1000.0 / Result.NsPerSample[1],
+						*Format(Result.Counters[FHardwareCounters::Cycles], 1.0), *Format(Result.Counters[FHardwareCounters::Instructions], 1.0), *Format(Result.GetIPC(), 1.0),
+						*Format(Result.Counters[FHardwareCounters::L1DMisses], 1000.0), *Format(Result.Counters[FHardwareCounters::LLCMisses], 1000.0), *Format(Result.Counters[FHardwareCounters::BranchMisses], 1000.0));
+				}
+				else
+				{
+					Ar.Logf(TEXT("%-26s %5d  %9.3f %9.1f  %9.3f %9.1f"), Case.Name, BlockSize, Result.NsPerSample[0], 1000.0 / Result.NsPerSample[0], Result.NsPerSample[1], 1000.0 / Result.NsPerSample[1]);
+				}
+			}
+		}
+
+		if (bWriteCSV)
+		{
+			WriteProfilingFile(TEXT("BenchmarkKernels"), TEXT("csv"), MakeKernelResultsCSV(Results), Ar);
+		}
+		if (bWriteJSON)
+		{
+			WriteProfilingFile(TEXT("BenchmarkKernels"), TEXT("json"), MakeKernelResultsJSON(Results, SamplesPerRun, NumRuns), Ar);
+		}
+	}
+
+	// Worst case mode. The last block of every pass is adversarial and the rest are the ordinary input, so the
+	// median is the kernel on audio and the tail is the adversarial block.
+	constexpr int32 WorstCaseBlockSize = 480;	// 48kHz at MetaSound's default 100 blocks per second
+	constexpr int32 WorstCaseBlocksPerPass = 8;
+	static_assert(WorstCaseBlockSize * WorstCaseBlocksPerPass <= MaxBlockSize, "A pass has to fit the case buffers");
+
+	static const float NonFiniteValues[] = { NAN, INFINITY, -INFINITY };
+	// zero, negative, at and past nyquist, and far past the tan table
+	static const float ExtremeCutoffs[] = { 0.0f, -1000.0f, 0.001f, 23999.0f, 24000.0f, 40000.0f, 1.0e9f };
+	static const float ExtremeQs[] = { 0.0f, -1.0f, 1.0e-6f, 1.0e6f };
+
+	// Cycles InValues through every InStride'th sample of the adversarial block, leaving the others as they were
+	template<int32 NumValues>
+	void SetWorstBlock(TArray<float>& OutBuffer, const float (&InValues)[NumValues], const int32 InStride = 1)
+	{
+		const int32 Start = (WorstCaseBlocksPerPass - 1) * WorstCaseBlockSize;
+		for (int32 Index = Start; Index < Start + WorstCaseBlockSize; Index += InStride)
+		{
+			OutBuffer[Index] = InValues[((Index - Start) / InStride) % NumValues];
+		}
+	}
+
+	void SetWorstBlock(TArray<float>& OutBuffer, const float InValue)
+	{
+		const float Values[] = { InValue };
+		SetWorstBlock(OutBuffer, Values);
+	}
+
+	// 1e-39 gives subnormal audio, 1e7 and up takes sWrap and sReflect past the float integer range
+	void ScaleWorstBlock(TArray<float>& OutBuffer, const float InScale)
+	{
+		const int32 Start = (WorstCaseBlocksPerPass - 1) * WorstCaseBlockSize;
+		for (int32 Index = Start; Index < Start + WorstCaseBlockSize; ++Index)
+		{
+			OutBuffer[Index] *= InScale;
+		}
+	}
+
+	// Large magnitudes with NaN and infinities on every other sample
+	void MakeWorstBlockExtreme(TArray<float>& OutBuffer, const float InScale)
+	{
+		ScaleWorstBlock(OutBuffer, InScale);
+		SetWorstBlock(OutBuffer, NonFiniteValues, 2);
+	}
+
+	// Same kernels as FKernelCase, fresh instances per case so no case inherits another's NaN state
+	static const FKernelCase WorstCaseKernelCases[] =
+	{
+		{ TEXT("Sine Polynomial Extreme"),
+			[](FKernelBuffers& B) { FillPhasor(B.Inputs[0], 440.0f); MakeWorstBlockExtreme(B.Inputs[0], 1.0e9f); },
+			[](FKernelInstances& K, FKernelBuffers& B, const int32 O, const int32 N) { K.SinePolynomial.ProcessAudioBuffer(B.In(0, O), B.Out(0, O), N); } },
+		{ TEXT("Sine WavetableCubic Extreme"),
+			[](FKernelBuffers& B) { FillPhasor(B.Inputs[0], 440.0f); MakeWorstBlockExtreme(B.Inputs[0], 1.0e9f); },
+			[](FKernelInstances& K, FKernelBuffers& B, const int32 O, const int32 N) { K.SineCubic.ProcessAudioBuffer(B.In(0, O), B.Out(0, O), N); } },
+		{ TEXT("Pow Subnormal"),
+			[](FKernelBuffers& B) { FillAudio(B.Inputs[0], 1.0f); FillConstant(B.Inputs[1], 2.5f); ScaleWorstBlock(B.Inputs[0], 1.0e-39f); },
+			[](FKernelInstances& K, FKernelBuffers& B, const int32 O, const int32 N) { K.Pow.ProcessAudioBuffer(B.In(0, O), B.Out(0, O), B.In(1, O), N); } },
+		{ TEXT("Pow Extreme"),
+			[](FKernelBuffers& B) { FillAudio(B.Inputs[0], 1.0f); FillSweep(B.Inputs[1], 0.5f, 3.0f, 2.0f); MakeWorstBlockExtreme(B.Inputs[0], 1.0e30f); SetWorstBlock(B.Inputs[1], NonFiniteValues, 3); },
+			[](FKernelInstances& K, FKernelBuffers& B, const int32 O, const int32 N) { K.Pow.ProcessAudioBuffer(B.In(0, O), B.Out(0, O), B.In(1, O), N); } },
+		{ TEXT("Pow ADAA Subnormal"),
+			[](FKernelBuffers& B) { FillAudio(B.Inputs[0], 1.0f); FillConstant(B.Inputs[1], 2.5f); ScaleWorstBlock(B.Inputs[0], 1.0e-39f); },
+			[](FKernelInstances& K, FKernelBuffers& B, const int32 O, const int32 N) { K.PowADAA.ProcessAudioBuffer(B.In(0, O), B.Out(0, O), B.In(1, O), N); } },
+		{ TEXT("Sqrt Precise Subnormal"),
+			[](FKernelBuffers& B) { FillAudio(B.Inputs[0], 1.0f); MakeWorstBlockExtreme(B.Inputs[0], 1.0e-39f); },
+			[](FKernelInstances& K, FKernelBuffers& B, const int32 O, const int32 N) { K.SqrtPrecise.ProcessAudioBuffer(B.In(0, O), B.Out(0, O), N); } },
+		{ TEXT("Sqrt Fast Subnormal"),
+			[](FKernelBuffers& B) { FillAudio(B.Inputs[0], 1.0f); MakeWorstBlockExtreme(B.Inputs[0], 1.0e-39f); },
+			[](FKernelInstances& K, FKernelBuffers& B, const int32 O, const int32 N) { K.SqrtFast.ProcessAudioBuffer(B.In(0, O), B.Out(0, O), N); } },
+		{ TEXT("Wrap Extreme"),
+			[](FKernelBuffers& B) { FillAudio(B.Inputs[0], 4.0f); MakeWorstBlockExtreme(B.Inputs[0], 1.0e7f); },
+			[](FKernelInstances& K, FKernelBuffers& B, const int32 O, const int32 N) { K.Wrap.ProcessAudioBuffer(B.In(0, O), B.Out(0, O), N); } },
+		{ TEXT("Wrap ADAA Extreme"),
+			[](FKernelBuffers& B) { FillAudio(B.Inputs[0], 4.0f); MakeWorstBlockExtreme(B.Inputs[0], 1.0e7f); },
+			[](FKernelInstances& K, FKernelBuffers& B, const int32 O, const int32 N) { K.WrapADAA.ProcessAudioBuffer(B.In(0, O), B.Out(0, O), N); } },
+		{ TEXT("Wrap Oversample 4x Extreme"),
+			[](FKernelBuffers& B) { FillAudio(B.Inputs[0], 4.0f); MakeWorstBlockExtreme(B.Inputs[0], 1.0e7f); },
+			[](FKernelInstances& K, FKernelBuffers& B, const int32 O, const int32 N) { K.Wrap4x.ProcessAudioBuffer(B.In(0, O), B.Out(0, O), N); } },
+		{ TEXT("Reflect Extreme"),
+			[](FKernelBuffers& B) { FillAudio(B.Inputs[0], 4.0f); MakeWorstBlockExtreme(B.Inputs[0], 1.0e7f); },
+			[](FKernelInstances& K, FKernelBuffers& B, const int32 O, const int32 N) { K.Reflect.ProcessAudioBuffer(B.In(0, O), B.Out(0, O), N); } },
+		{ TEXT("Reflect ADAA Extreme"),
+			[](FKernelBuffers& B) { FillAudio(B.Inputs[0], 4.0f); MakeWorstBlockExtreme(B.Inputs[0], 1.0e7f); },
+			[](FKernelInstances& K, FKernelBuffers& B, const int32 O, const int32 N) { K.ReflectADAA.ProcessAudioBuffer(B.In(0, O), B.Out(0, O), N); } },
+		{ TEXT("AudioDivide Precise Zero"),
+			[](FKernelBuffers& B) { FillAudio(B.Inputs[0], 1.0f); FillAudio(B.Inputs[1], 1.0f, 2); SetWorstBlock(B.Inputs[1], 0.0f); },
+			[](FKernelInstances& K, FKernelBuffers& B, const int32 O, const int32 N) { K.DividePrecise.ProcessAudioBuffer(B.In(0, O), B.Out(0, O), B.In(1, O), N); } },
+		{ TEXT("AudioDivide Precise Extreme"),
+			[](FKernelBuffers& B) { FillAudio(B.Inputs[0], 1.0f); FillAudio(B.Inputs[1], 1.0f, 2); ScaleWorstBlock(B.Inputs[0], 1.0e30f); MakeWorstBlockExtreme(B.Inputs[1], 1.0e-39f); },
+			[](FKernelInstances& K, FKernelBuffers& B, const int32 O, const int32 N) { K.DividePrecise.ProcessAudioBuffer(B.In(0, O), B.Out(0, O), B.In(1, O), N); } },
+		{ TEXT("AudioDivide Fast Zero"),
+			[](FKernelBuffers& B) { FillAudio(B.Inputs[0], 1.0f); FillAudio(B.Inputs[1], 1.0f, 2); SetWorstBlock(B.Inputs[1], 0.0f); },
+			[](FKernelInstances& K, FKernelBuffers& B, const int32 O, const int32 N) { K.DivideFast.ProcessAudioBuffer(B.In(0, O), B.Out(0, O), B.In(1, O), N); } },
+		{ TEXT("AudioDivide Fast Extreme"),
+			[](FKernelBuffers& B) { FillAudio(B.Inputs[0], 1.0f); FillAudio(B.Inputs[1], 1.0f, 2); ScaleWorstBlock(B.Inputs[0], 1.0e30f); MakeWorstBlockExtreme(B.Inputs[1], 1.0e-39f); },
+			[](FKernelInstances& K, FKernelBuffers& B, const int32 O, const int32 N) { K.DivideFast.ProcessAudioBuffer(B.In(0, O), B.Out(0, O), B.In(1, O), N); } },
+		{ TEXT("OnePoleIIR Subnormal"),
+			[](FKernelBuffers& B) { FillAudio(B.Inputs[0], 1.0f); FillConstant(B.Inputs[1], 0.99f); FillConstant(B.Inputs[2], 0.01f); ScaleWorstBlock(B.Inputs[0], 1.0e-39f); },
+			[](FKernelInstances& K, FKernelBuffers& B, const int32 O, const int32 N) { K.OnePoleIIR.ProcessAudioBuffer(B.In(0, O), B.Out(0, O), B.In(1, O), B.In(2, O), N); } },
+		{ TEXT("OnePoleFIR Subnormal"),
+			[](FKernelBuffers& B) { FillAudio(B.Inputs[0], 1.0f); FillConstant(B.Inputs[1], 0.5f); FillConstant(B.Inputs[2], 0.5f); ScaleWorstBlock(B.Inputs[0], 1.0e-39f); },
+			[](FKernelInstances& K, FKernelBuffers& B, const int32 O, const int32 N) { K.OnePoleFIR.ProcessAudioBuffer(B.In(0, O), B.Out(0, O), B.In(1, O), B.In(2, O), N); } },
+		{ TEXT("RZero Subnormal"),
+			[](FKernelBuffers& B) { FillAudio(B.Inputs[0], 1.0f); ScaleWorstBlock(B.Inputs[0], 1.0e-39f); },
+			[](FKernelInstances& K, FKernelBuffers& B, const int32 O, const int32 N) { K.RZeroPrior = K.RZero.ProcessAudioBuffer(B.In(0, O), B.Out(0, O), 0.95f, K.RZeroPrior, N); } },
+		{ TEXT("Samphold NonFinite"),
+			[](FKernelBuffers& B) { FillAudio(B.Inputs[0], 1.0f); FillPhasor(B.Inputs[1], 100.0f); SetWorstBlock(B.Inputs[0], NonFiniteValues, 2); SetWorstBlock(B.Inputs[1], NonFiniteValues, 3); },
+			[](FKernelInstances& K, FKernelBuffers& B, const int32 O, const int32 N) { K.Samphold.ProcessAudioBuffer(B.In(0, O), B.Out(0, O), B.In(1, O), N); } },
+		{ TEXT("VCF Subnormal"),
+			[](FKernelBuffers& B) { FillAudio(B.Inputs[0], 1.0f); FillConstant(B.Inputs[1], 1000.0f); FillConstant(B.Inputs[2], 2.0f); ScaleWorstBlock(B.Inputs[0], 1.0e-39f); },
+			[](FKernelInstances& K, FKernelBuffers& B, const int32 O, const int32 N) { K.SVF.ProcessAudioBuffer(B.In(0, O), B.Out(0, O), B.In(1, O), B.In(2, O), N); } },
+		{ TEXT("VCF Extreme Cutoff"),
+			[](FKernelBuffers& B) { FillAudio(B.Inputs[0], 1.0f); FillSweep(B.Inputs[1], 200.0f, 8000.0f, 0.5f); FillConstant(B.Inputs[2], 2.0f); SetWorstBlock(B.Inputs[1], ExtremeCutoffs); },
+			[](FKernelInstances& K, FKernelBuffers& B, const int32 O, const int32 N) { K.SVF.ProcessAudioBuffer(B.In(0, O), B.Out(0, O), B.In(1, O), B.In(2, O), N); } },
+		{ TEXT("VCF Extreme Q"),
+			[](FKernelBuffers& B) { FillAudio(B.Inputs[0], 1.0f); FillSweep(B.Inputs[1], 200.0f, 8000.0f, 0.5f); FillSweep(B.Inputs[2], 0.7f, 5.0f, 0.3f); SetWorstBlock(B.Inputs[2], ExtremeQs); },
+			[](FKernelInstances& K, FKernelBuffers& B, const int32 O, const int32 N) { K.SVF.ProcessAudioBuffer(B.In(0, O), B.Out(0, O), B.In(1, O), B.In(2, O), N); } },
+		{ TEXT("VCF NonFinite"),
+			[](FKernelBuffers& B) { FillAudio(B.Inputs[0], 1.0f); FillSweep(B.Inputs[1], 200.0f, 8000.0f, 0.5f); FillSweep(B.Inputs[2], 0.7f, 5.0f, 0.3f); SetWorstBlock(B.Inputs[1], NonFiniteValues, 5); SetWorstBlock(B.Inputs[2], NonFiniteValues, 7); },
+			[](FKernelInstances& K, FKernelBuffers& B, const int32 O, const int32 N) { K.SVF.ProcessAudioBuffer(B.In(0, O), B.Out(0, O), B.In(1, O), B.In(2, O), N); } },
+		{ TEXT("VCF Every16 Extreme Cutoff"),
+			[](FKernelBuffers& B) { FillAudio(B.Inputs[0], 1.0f); FillSweep(B.Inputs[1], 200.0f, 8000.0f, 0.5f); FillConstant(B.Inputs[2], 2.0f); SetWorstBlock(B.Inputs[1], ExtremeCutoffs); },
+			[](FKernelInstances& K, FKernelBuffers& B, const int32 O, const int32 N) { K.SVFControlRate.ProcessAudioBuffer(B.In(0, O), B.Out(0, O), B.In(1, O), B.In(2, O), N); } },
+		{ TEXT("VCF Multimode Extreme"),
+			[](FKernelBuffers& B) { FillAudio(B.Inputs[0], 1.0f); FillSweep(B.Inputs[1], 200.0f, 8000.0f, 0.5f); FillSweep(B.Inputs[2], 0.7f, 5.0f, 0.3f); ScaleWorstBlock(B.Inputs[0], 1.0e-39f); SetWorstBlock(B.Inputs[1], ExtremeCutoffs); SetWorstBlock(B.Inputs[2], ExtremeQs); },
+			[](FKernelInstances& K, FKernelBuffers& B, const int32 O, const int32 N) { K.SVFMultimode.ProcessAudioBufferMultimode(B.In(0, O), B.In(1, O), B.In(2, O), B.Out(0, O), B.Out(1, O), B.Out(2, O), B.Out(3, O), B.Out(4, O), N); } },
+		{ TEXT("VCF Bank 16 Subnormal"),
+			[](FKernelBuffers& B) { FillAudio(B.Inputs[0], 1.0f); ScaleWorstBlock(B.Inputs[0], 1.0e-39f); },
+			[](FKernelInstances& K, FKernelBuffers& B, const int32 O, const int32 N) { K.SVFBank.ProcessAudioBuffer(B.In(0, O), B.Out(0, O), N); } },
+	};
+
+#if METASOUNDSAUDIOMATHUTILS_WITH_OPERATORS
+	// Operators built directly around four input buffers, so Execute() runs exactly as it does in a graph
+	struct FOperatorCase
+	{
+		const TCHAR* Name;
+		void (*Fill)(FKernelBuffers& OutBuffers);
+		TUniquePtr<Metasound::IOperator> (*Create)(const Metasound::FOperatorSettings& InSettings, const TArray<Metasound::FAudioBufferReadRef>& InInputs);
+	};
+
+	static const FOperatorCase WorstCaseOperatorCases[] =
+	{
+		{ TEXT("Wrap Operator Extreme"),
+			[](FKernelBuffers& B) { FillAudio(B.Inputs[0], 4.0f); MakeWorstBlockExtreme(B.Inputs[0], 1.0e7f); },
+			[](const Metasound::FOperatorSettings& S, const TArray<Metasound::FAudioBufferReadRef>& I) -> TUniquePtr<Metasound::IOperator>
+			{
+				using namespace Metasound;
+				return MakeUnique<FWrapOperator>(S, I[0], FEnumAudioOversampleReadRef::CreateNew(EAudioOversample::None), FBoolReadRef::CreateNew(false));
+			} },
+		{ TEXT("Reflect Operator Extreme"),
+			[](FKernelBuffers& B) { FillAudio(B.Inputs[0], 4.0f); MakeWorstBlockExtreme(B.Inputs[0], 1.0e7f); },
+			[](const Metasound::FOperatorSettings& S, const TArray<Metasound::FAudioBufferReadRef>& I) -> TUniquePtr<Metasound::IOperator>
+			{
+				using namespace Metasound;
+				return MakeUnique<FReflectOperator>(S, I[0], FEnumAudioOversampleReadRef::CreateNew(EAudioOversample::None), FBoolReadRef::CreateNew(false));
+			} },
+		{ TEXT("Pow Operator Subnormal"),
+			[](FKernelBuffers& B) { FillAudio(B.Inputs[0], 1.0f); FillConstant(B.Inputs[1], 2.5f); ScaleWorstBlock(B.Inputs[0], 1.0e-39f); },
+			[](const Metasound::FOperatorSettings& S, const TArray<Metasound::FAudioBufferReadRef>& I) -> TUniquePtr<Metasound::IOperator>
+			{
+				using namespace Metasound;
+				return MakeUnique<FPowOperator>(S, I[0], I[1], FEnumAudioOversampleReadRef::CreateNew(EAudioOversample::None), FBoolReadRef::CreateNew(false));
+			} },
+		{ TEXT("AudioDivide Operator Zero"),
+			[](FKernelBuffers& B) { FillAudio(B.Inputs[0], 1.0f); FillAudio(B.Inputs[1], 1.0f, 2); SetWorstBlock(B.Inputs[1], 0.0f); },
+			[](const Metasound::FOperatorSettings& S, const TArray<Metasound::FAudioBufferReadRef>& I) -> TUniquePtr<Metasound::IOperator>
+			{
+				using namespace Metasound;
+				return MakeUnique<FAudioDivideOperator>(S, I[0], I[1], FEnumAudioAccuracyReadRef::CreateNew(EAudioAccuracy::Precise));
+			} },
+		{ TEXT("OnePoleIIR Operator Subnormal"),
+			[](FKernelBuffers& B) { FillAudio(B.Inputs[0], 1.0f); FillConstant(B.Inputs[1], 0.99f); FillConstant(B.Inputs[2], 0.01f); ScaleWorstBlock(B.Inputs[0], 1.0e-39f); },
+			[](const Metasound::FOperatorSettings& S, const TArray<Metasound::FAudioBufferReadRef>& I) -> TUniquePtr<Metasound::IOperator>
+			{
+				using namespace Metasound;
+				return MakeUnique<FOnePoleIIROperator>(S, I[0], I[1], I[2]);
+			} },
+		{ TEXT("VCF Operator Extreme"),
+			[](FKernelBuffers& B) { FillAudio(B.Inputs[0], 1.0f); FillSweep(B.Inputs[1], 200.0f, 8000.0f, 0.5f); FillSweep(B.Inputs[2], 0.7f, 5.0f, 0.3f); ScaleWorstBlock(B.Inputs[0], 1.0e-39f); SetWorstBlock(B.Inputs[1], ExtremeCutoffs); SetWorstBlock(B.Inputs[2], ExtremeQs); },
+			[](const Metasound::FOperatorSettings& S, const TArray<Metasound::FAudioBufferReadRef>& I) -> TUniquePtr<Metasound::IOperator>
+			{
+				using namespace Metasound;
+				FEnumVCFFilterTypeReadRef FilterType = FEnumVCFFilterTypeReadRef::CreateNew(EVCFFilterType::LowPass);
+				return MakeUnique<FVCFOperator>(S, I[0], I[1], I[2], FilterType, FEnumVCFUpdateRateReadRef::CreateNew(EVCFUpdateRate::EverySample), FBoolReadRef::CreateNew(false));
+			} },
+		{ TEXT("VCF Operator Every16 TanTable Extreme"),
+			[](FKernelBuffers& B) { FillAudio(B.Inputs[0], 1.0f); FillSweep(B.Inputs[1], 200.0f, 8000.0f, 0.5f); FillSweep(B.Inputs[2], 0.7f, 5.0f, 0.3f); ScaleWorstBlock(B.Inputs[0], 1.0e-39f); SetWorstBlock(B.Inputs[1], ExtremeCutoffs); SetWorstBlock(B.Inputs[2], ExtremeQs); },
+			[](const Metasound::FOperatorSettings& S, const TArray<Metasound::FAudioBufferReadRef>& I) -> TUniquePtr<Metasound::IOperator>
+			{
+				using namespace Metasound;
+				FEnumVCFFilterTypeReadRef FilterType = FEnumVCFFilterTypeReadRef::CreateNew(EVCFFilterType::LowPass);
+				return MakeUnique<FVCFOperator>(S, I[0], I[1], I[2], FilterType, FEnumVCFUpdateRateReadRef::CreateNew(EVCFUpdateRate::Every16), FBoolReadRef::CreateNew(true));
+			} },
+	};
+#endif
+
+	// One untimed pass, then InNumPasses passes timed a block at a time. InPrepareBlock runs outside the timing.
+	template<typename PrepareType, typename ProcessType>
+	void TimeBlocks(const int32 InNumPasses, TArray<double>& OutTimes, TArray<double>& OutAdversarialTimes, PrepareType InPrepareBlock, ProcessType InProcessBlock)
+	{
+		const double MicrosecondsPerCycle = FPlatformTime::GetSecondsPerCycle64() * 1.0e6;
+
+		OutTimes.Reset();
+		OutAdversarialTimes.Reset();
+		for (int32 Pass = -1; Pass < InNumPasses; ++Pass)
+		{
+			for (int32 Block = 0; Block < WorstCaseBlocksPerPass; ++Block)
+			{
+				InPrepareBlock(Block);
+				const uint64 Start = FPlatformTime::Cycles64();
+				InProcessBlock(Block);
+				const double Time = (double)(FPlatformTime::Cycles64() - Start) * MicrosecondsPerCycle;
+
+				if (Pass >= 0)
+				{
+					OutTimes.Add(Time);
+					if (Block == WorstCaseBlocksPerPass - 1)
+					{
+						OutAdversarialTimes.Add(Time);
+					}
+				}
+			}
+		}
+	}
+
+	// InSorted ascending
+	double Percentile(const TArray<double>& InSorted, const double InFraction)
+	{
+		return InSorted[FMath::Min(InSorted.Num() - 1, (int32)(InFraction * (double)InSorted.Num()))];
+	}
+
+	void LogWorstCase(const TCHAR* InName, TArray<double>& InTimes, TArray<double>& InAdversarialTimes, const float InMultiple, FOutputDevice& Ar)
+	{
+		InTimes.Sort();
+		InAdversarialTimes.Sort();
+
+		const double Median = Percentile(InTimes, 0.5);
+		const double P999 = Percentile(InTimes, 0.999);
+		const double Ratio = P999 / FMath::Max(Median, 1.0e-9);
+		Ar.Logf(TEXT("%-36s %9.2f %9.2f %9.2f %9.2f %8.1fx %s"), InName, Median, Percentile(InAdversarialTimes, 0.5), P999, InTimes[InTimes.Num() - 1], Ratio, Ratio > InMultiple ? TEXT("SLOW") : TEXT(""));
+	}
+
+	void BenchmarkWorstCase(const TArray<FString>& Args, FOutputDevice& Ar)
+	{
+		// 16000 blocks, so p99.9 is set by 16 of them
+		constexpr int32 NumPasses = 2000;
+
+		float Multiple = 4.0f;
+		const TCHAR* Filter = nullptr;
+		for (const FString& Arg : Args)
+		{
+			if (FCString::IsNumeric(*Arg))
+			{
+				Multiple = FCString::Atof(*Arg);
+			}
+			else
+			{
+				Filter = *Arg;
+			}
+		}
+
+		TUniquePtr<FKernelBuffers> Buffers = MakeUnique<FKernelBuffers>();
+		TArray<double> Times;
+		TArray<double> AdversarialTimes;
+
+		Ar.Logf(TEXT("us per %d sample block over %d blocks, 1 in %d adversarial. SLOW when p99.9 is over %.1fx the median, max includes preemption so is reported only."),
+			WorstCaseBlockSize, NumPasses * WorstCaseBlocksPerPass, WorstCaseBlocksPerPass, Multiple);
+		Ar.Logf(TEXT("%-36s %9s %9s %9s %9s %9s"), TEXT("Case"), TEXT("Median"), TEXT("AdvMedian"), TEXT("p99.9"), TEXT("Max"), TEXT("p99.9/Med"));
+
+		for (const FKernelCase& Case : WorstCaseKernelCases)
+		{
+			if (!MatchesFilter(Case.Name, Filter))
+			{
+				continue;
+			}
+
+			Case.Fill(*Buffers);
+			TUniquePtr<FKernelInstances> Kernels = MakeUnique<FKernelInstances>();
+
+			TimeBlocks(NumPasses, Times, AdversarialTimes, [](const int32 /*Block*/) {}, [&](const int32 Block)
+				{
+					Case.Process(*Kernels, *Buffers, Block * WorstCaseBlockSize, WorstCaseBlockSize);
+				});
+			LogWorstCase(Case.Name, Times, AdversarialTimes, Multiple, Ar);
+		}
+
+#if METASOUNDSAUDIOMATHUTILS_WITH_OPERATORS
+		const Metasound::FOperatorSettings Settings(BenchmarkSampleRate, BenchmarkSampleRate / (float)WorstCaseBlockSize);
+		const int32 NumFrames = FMath::Min(Settings.GetNumFramesPerBlock(), WorstCaseBlockSize);
+
+		for (const FOperatorCase& Case : WorstCaseOperatorCases)
+		{
+			if (!MatchesFilter(Case.Name, Filter))
+			{
+				continue;
+			}
+
+			Case.Fill(*Buffers);
+
+			TArray<Metasound::FAudioBufferWriteRef> Inputs;
+			TArray<Metasound::FAudioBufferReadRef> ReadInputs;
+			for (int32 Input = 0; Input < FKernelBuffers::NumInputs; ++Input)
+			{
+				Inputs.Add(Metasound::FAudioBufferWriteRef::CreateNew(Settings));
+				ReadInputs.Add(Inputs[Input]);
+			}
+
+			TUniquePtr<Metasound::IOperator> Operator = Case.Create(Settings, ReadInputs);
+			const Metasound::IOperator::FExecuteFunction Execute = Operator->GetExecuteFunction();
+
+			TimeBlocks(NumPasses, Times, AdversarialTimes, [&](const int32 Block)
+				{
+					for (int32 Input = 0; Input < FKernelBuffers::NumInputs; ++Input)
+					{
+						FMemory::Memcpy(Inputs[Input]->GetData(), Buffers->In(Input, Block * WorstCaseBlockSize), NumFrames * sizeof(float));
+					}
+				},
+				[&](const int32 /*Block*/)
+				{
+					Execute(Operator.Get());
+				});
+			LogWorstCase(Case.Name, Times, AdversarialTimes, Multiple, Ar);
+		}
+#endif
+	}
+
+	// Scaling mode. N instances of one kernel, each with its own audio input and output block, run round-robin a
+	// block at a time the way the render thread walks a graph. Control inputs are shared, like one modulator
+	// driving every voice.
+	constexpr int32 ScalingBlockSize = 480;
+	static const int32 ScalingInstanceCounts[] = { 1, 3, 10, 30, 100, 300, 1000, 3000, 10000 };
+
+	enum class EScalingLayout : uint8
+	{
+		Separate,
+		Contiguous,
+		Interleaved,
+		Num
+	};
+
+	static const TCHAR* ScalingLayoutNames[] = { TEXT("Separate"), TEXT("Contiguous"), TEXT("Interleaved") };
+
+	struct FScalingControls
+	{
+		TArray<float> Cutoff;
+		TArray<float> Q;
+		TArray<float> CoefA;
+		TArray<float> CoefB;
+
+		FScalingControls()
+		{
+			Cutoff.SetNumUninitialized(ScalingBlockSize);
+			Q.SetNumUninitialized(ScalingBlockSize);
+			CoefA.SetNumUninitialized(ScalingBlockSize);
+			CoefB.SetNumUninitialized(ScalingBlockSize);
+			FillSweep(Cutoff, 200.0f, 8000.0f, 100.0f);
+			FillSweep(Q, 0.7f, 5.0f, 100.0f);
+			FillConstant(CoefA, 0.99f);
+			FillConstant(CoefB, 0.01f);
+		}
+	};
+
+	struct FWrapScaling
+	{
+		using KernelType = DSPProcessing::FWrap;
+
+		static void Setup(KernelType& /*OutKernel*/) {}
+
+		static void Process(KernelType& InKernel, const float* InAudio, float* OutAudio, const FScalingControls& /*InControls*/)
+		{
+			InKernel.ProcessAudioBuffer(InAudio, OutAudio, ScalingBlockSize);
+		}
+	};
+
+	struct FWrapOversample2xScaling
+	{
+		using KernelType = DSPProcessing::TOversampled<DSPProcessing::FWrap, 2>;
+
+		static void Setup(KernelType& OutKernel)
+		{
+			OutKernel.SetMaxBlockSize(ScalingBlockSize);
+		}
+
+		static void Process(KernelType& InKernel, const float* InAudio, float* OutAudio, const FScalingControls& /*InControls*/)
+		{
+			InKernel.ProcessAudioBuffer(InAudio, OutAudio, ScalingBlockSize);
+		}
+	};
+
+	struct FOnePoleIIRScaling
+	{
+		using KernelType = DSPProcessing::FOnePoleIIR;
+
+		static void Setup(KernelType& /*OutKernel*/) {}
+
+		static void Process(KernelType& InKernel, const float* InAudio, float* OutAudio, const FScalingControls& InControls)
+		{
+			InKernel.ProcessAudioBuffer(InAudio, OutAudio, InControls.CoefA.GetData(), InControls.CoefB.GetData(), ScalingBlockSize);
+		}
+	};
+
+	struct FVCFScaling
+	{
+		using KernelType = DSPProcessing::CytomicSVF;
+
+		static void Setup(KernelType& OutKernel)
+		{
+			OutKernel.SetSampleRate(BenchmarkSampleRate);
+			OutKernel.SetMaxBlockSize(ScalingBlockSize);
+			OutKernel.SetLPF();
+		}
+
+		static void Process(KernelType& InKernel, const float* InAudio, float* OutAudio, const FScalingControls& InControls)
+		{
+			InKernel.ProcessAudioBuffer(InAudio, OutAudio, InControls.Cutoff.GetData(), InControls.Q.GetData(), ScalingBlockSize);
+		}
+	};
+
+	// Builds InNumInstances instances in InLayout and times round-robin ticks over them, in ns per instance sample
+	template<typename PolicyType>
+	double TimeScaling(const EScalingLayout InLayout, const int32 InNumInstances, const FScalingControls& InControls, const TArray<float>& InAudio)
+	{
+		using KernelType = typename PolicyType::KernelType;
+
+		// about a million instance samples per run, and at least one tick
+		constexpr int32 NumRuns = 5;
+		const int32 NumTicks = FMath::Max(1, (1 << 20) / (InNumInstances * ScalingBlockSize));
+		const int32 NumSamples = NumTicks * InNumInstances * ScalingBlockSize;
+
+		switch (InLayout)
+		{
+		case EScalingLayout::Separate:
+		{
+			// a heap allocation for each kernel and each buffer, as an operator owns its kernel and FAudioBuffers
+			struct FInstance
+			{
+				KernelType Kernel;
+				TArray<float> Input;
+				TArray<float> Output;
+			};
+
+			TArray<TUniquePtr<FInstance>> Instances;
+			for (int32 Index = 0; Index < InNumInstances; ++Index)
+			{
+				Instances.Add(MakeUnique<FInstance>());
+				PolicyType::Setup(Instances[Index]->Kernel);
+				Instances[Index]->Input = InAudio;
+				Instances[Index]->Output.SetNumZeroed(ScalingBlockSize);
+			}
+
+			return TimeNsPerSample(NumSamples, NumRuns, [&]()
+				{
+					for (int32 Tick = 0; Tick < NumTicks; ++Tick)
+					{
+						for (const TUniquePtr<FInstance>& Instance : Instances)
+						{
+							PolicyType::Process(Instance->Kernel, Instance->Input.GetData(), Instance->Output.GetData(), InControls);
+						}
+					}
+				});
+		}
+
+		case EScalingLayout::Contiguous:
+		{
+			// kernels in one array, inputs in one slab and outputs in another
+			TArray<KernelType> Kernels;
+			TArray<float> Inputs;
+			TArray<float> Outputs;
+			Kernels.SetNum(InNumInstances);
+			Inputs.SetNumUninitialized(InNumInstances * ScalingBlockSize);
+			Outputs.SetNumZeroed(InNumInstances * ScalingBlockSize);
+			for (int32 Index = 0; Index < InNumInstances; ++Index)
+			{
+				PolicyType::Setup(Kernels[Index]);
+				FMemory::Memcpy(Inputs.GetData() + Index * ScalingBlockSize, InAudio.GetData(), ScalingBlockSize * sizeof(float));
+			}
+
+			return TimeNsPerSample(NumSamples, NumRuns, [&]()
+				{
+					for (int32 Tick = 0; Tick < NumTicks; ++Tick)
+					{
+						for (int32 Index = 0; Index < InNumInstances; ++Index)
+						{
+							PolicyType::Process(Kernels[Index], Inputs.GetData() + Index * ScalingBlockSize, Outputs.GetData() + Index * ScalingBlockSize, InControls);
+						}
+					}
+				});
+		}
+
+		default:
+		{
+			// each kernel followed by its own input and output
+			struct FInstance
+			{
+				KernelType Kernel;
+				alignas(16) float Input[ScalingBlockSize];
+				alignas(16) float Output[ScalingBlockSize];
+			};
+
+			TArray<FInstance> Instances;
+			Instances.SetNum(InNumInstances);
+			for (FInstance& Instance : Instances)
+			{
+				PolicyType::Setup(Instance.Kernel);
+				FMemory::Memcpy(Instance.Input, InAudio.GetData(), ScalingBlockSize * sizeof(float));
+				FMemory::Memzero(Instance.Output, ScalingBlockSize * sizeof(float));
+			}
+
+			return TimeNsPerSample(NumSamples, NumRuns, [&]()
+				{
+					for (int32 Tick = 0; Tick < NumTicks; ++Tick)
+					{
+						for (FInstance& Instance : Instances)
+						{
+							PolicyType::Process(Instance.Kernel, Instance.Input, Instance.Output, InControls);
+						}
+					}
+				});
+		}
+		}
+	}
+
+	struct FScalingCase
+	{
+		const TCHAR* Name;
+		double (*Time)(const EScalingLayout InLayout, const int32 InNumInstances, const FScalingControls& InControls, const TArray<float>& InAudio);
+		// the kernel object plus its input and output block, not counting buffers the kernel allocates itself
+		SIZE_T InstanceBytes;
+	};
+
+	static const FScalingCase ScalingCases[] =
+	{
+		{ TEXT("Wrap"), &TimeScaling<FWrapScaling>, sizeof(FWrapScaling::KernelType) + 2 * ScalingBlockSize * sizeof(float) },
+		{ TEXT("Wrap Oversample 2x"), &TimeScaling<FWrapOversample2xScaling>, sizeof(FWrapOversample2xScaling::KernelType) + 2 * ScalingBlockSize * sizeof(float) },
+		{ TEXT("OnePoleIIR"), &TimeScaling<FOnePoleIIRScaling>, sizeof(FOnePoleIIRScaling::KernelType) + 2 * ScalingBlockSize * sizeof(float) },
+		{ TEXT("VCF Modulated"), &TimeScaling<FVCFScaling>, sizeof(FVCFScaling::KernelType) + 2 * ScalingBlockSize * sizeof(float) },
+	};
+
+	void BenchmarkScaling(const TArray<FString>& Args, FOutputDevice& Ar)
+	{
+		int32 MaxInstances = 10000;
+		const TCHAR* Filter = nullptr;
+		bool bWriteCSV = false;
+		for (const FString& Arg : Args)
+		{
+			if (Arg == TEXT("CSV"))
+			{
+				bWriteCSV = true;
+			}
+			else if (FCString::IsNumeric(*Arg))
+			{
+				MaxInstances = FMath::Max(1, FCString::Atoi(*Arg));
+			}
+			else
+			{
+				Filter = *Arg;
+			}
+		}
+
+		const FScalingControls Controls;
+		TArray<float> Audio;
+		Audio.SetNumUninitialized(ScalingBlockSize);
+		FillAudio(Audio, 1.0f);
+
+		FString CSV = TEXT("kernel,instances,layout,ns_per_sample,instance_bytes\n");
+
+		Ar.Logf(TEXT("ns per instance sample, %d sample blocks round-robin over every instance, best of 5 runs. x is against 1 instance."), ScalingBlockSize);
+		Ar.Logf(TEXT("Separate: an allocation per kernel and buffer. Contiguous: kernels in one array, buffers in slabs. Interleaved: each kernel next to its buffers."));
+
+		for (const FScalingCase& Case : ScalingCases)
+		{
+			if (!MatchesFilter(Case.Name, Filter))
+			{
+				continue;
+			}
+
+			Ar.Logf(TEXT("%s, %.1f KB per instance plus any buffers the kernel allocates"), Case.Name, (double)Case.InstanceBytes / 1024.0);
+			Ar.Logf(TEXT("  %9s %9s  %9s %6s  %9s %6s  %9s %6s"), TEXT("Instances"), TEXT("MB"), ScalingLayoutNames[0], TEXT("x"), ScalingLayoutNames[1], TEXT("x"), ScalingLayoutNames[2], TEXT("x"));
+
+			double SingleInstance[(int32)EScalingLayout::Num] = {};
+			for (const int32 NumInstances : ScalingInstanceCounts)
+			{
+				if (NumInstances > MaxInstances)
+				{
+					break;
+				}
+
+				double NsPerSample[(int32)EScalingLayout::Num];
+				for (int32 Layout = 0; Layout < (int32)EScalingLayout::Num; ++Layout)
+				{
+					NsPerSample[Layout] = Case.Time((EScalingLayout)Layout, NumInstances, Controls, Audio);
+					if (SingleInstance[Layout] == 0.0)
+					{
+						SingleInstance[Layout] = NsPerSample[Layout];
+					}
+					CSV += FString::Printf(TEXT("%s,%d,%s,%.4f,%d\n"), Case.Name, NumInstances, ScalingLayoutNames[Layout], NsPerSample[Layout], (int32)Case.InstanceBytes);
+				}
+
+				Ar.Logf(TEXT("  %9d %9.1f  %9.3f %5.2fx  %9.3f %5.2fx  %9.3f %5.2fx"), NumInstances, (double)NumInstances * (double)Case.InstanceBytes / (1024.0 * 1024.0),
+					NsPerSample[0], NsPerSample[0] / SingleInstance[0], NsPerSample[1], NsPerSample[1] / SingleInstance[1], NsPerSample[2], NsPerSample[2] / SingleInstance[2]);
+			}
+		}
+
+		if (bWriteCSV)
+		{
+			WriteProfilingFile(TEXT("BenchmarkScaling"), TEXT("csv"), CSV, Ar);
+		}
+	}
+
+	static FAutoConsoleCommandWithOutputDevice BenchmarkTanCommand(
+		TEXT("au.MathUtils.BenchmarkTan"),
+		TEXT("Compares Audio::FastTan, the VCF tan table and FMath::Tan for cost and error."),
+		FConsoleCommandWithOutputDeviceDelegate::CreateStatic(&BenchmarkTan));
+
+	static FAutoConsoleCommandWithArgsAndOutputDevice BenchmarkKernelsCommand(
+		TEXT("au.MathUtils.BenchmarkKernels"),
+		TEXT("Times every DSPProcessing kernel on realistic input at block sizes 32 to 4096, aligned and misaligned. Optional arguments: kernel name filter, Counters for hardware counters (Linux), CSV and JSON to write the results to Saved/Profiling."),
+		FConsoleCommandWithArgsAndOutputDeviceDelegate::CreateStatic(&BenchmarkKernels));
+
+	static FAutoConsoleCommandWithArgsAndOutputDevice BenchmarkWorstCaseCommand(
+		TEXT("au.MathUtils.BenchmarkWorstCase"),
+		TEXT("Per block timing of the kernels and several operators' Execute() with large, subnormal, NaN and Inf inputs, zero divisors and extreme VCF cutoff and Q. Reports median, p99.9 and max. Optional arguments: the p99.9 to median ratio to flag (default 4), kernel name filter."),
+		FConsoleCommandWithArgsAndOutputDeviceDelegate::CreateStatic(&BenchmarkWorstCase));
+
+	static FAutoConsoleCommandWithArgsAndOutputDevice BenchmarkScalingCommand(
+		TEXT("au.MathUtils.BenchmarkScaling"),
+		TEXT("Runs 1 to 10000 instances of several kernels round-robin in three state layouts and reports ns per instance sample as the count grows. Optional arguments: max instance count, kernel name filter, CSV to write the results to Saved/Profiling."),
+		FConsoleCommandWithArgsAndOutputDeviceDelegate::CreateStatic(&BenchmarkScaling));
+}
+
+#endif // !UE_BUILD_SHIPPING
@@ -0,0 +1,1155 @@
+// Copyright Christopher Wratt 2024.
+// All code under MIT license: see https://mit-license.org/
+
+// Developer console command and automation test that check the optimized DSPProcessing kernels against frozen
+// copies of the original scalar kernels, on random and edge case input. Kernels the originals have no counterpart
+// for, the ADAA and oversampled ones, are held to the bounds their output can't leave instead.
+
+#include "CoreMinimal.h"
+#include "HAL/IConsoleManager.h"
+#include "Math/RandomStream.h"
+#include "Misc/AutomationTest.h"
+#include "AudioUtils.h"
+#include "CytomicSVF.h"
+#include "Oversampler.h"
+#include "DSP/Dsp.h"
+
+#if !UE_BUILD_SHIPPING
+
+namespace MetasoundsAudioMathUtilsVerification
+{
+	// The kernels as they were before any of them were vectorised, kept as the reference for what the nodes should
+	// output. Copied as is, apart from the changes marked below that were made on purpose since.
+	namespace Reference
+	{
+		class FAudioDivide
+		{
+		public:
+			void ProcessAudioBuffer(const float* InBuffer, float* OutBuffer, const float* InputAudioDivide, const int32 InNumSamples)
+			{
+				for (int32 Index = 0; Index < InNumSamples; ++Index)
+				{
+					// protect against divide by zero
+					OutBuffer[Index] = InputAudioDivide[Index] == 0.0f ? 0.0f : InBuffer[Index] / InputAudioDivide[Index];
+				}
+			}
+		};
+
+		class FCos
+		{
+		public:
+			void ProcessAudioBuffer(const float* InBuffer, float* OutBuffer, const int32 InNumSamples)
+			{
+				for (int32 Index = 0; Index < InNumSamples; ++Index)
+				{
+					OutBuffer[Index] = FMath::Cos((2.0f * PI) * InBuffer[Index]);
+				}
+			}
+		};
+
+		class FGate
+		{
+		public:
+			void ProcessAudioBuffer(const float* InBuffer, float* OutBuffer, const float* InputGateToggle, const int32 InNumSamples)
+			{
+				for (int32 Index = 0; Index < InNumSamples; ++Index)
+				{
+					OutBuffer[Index] = FMath::RoundHalfFromZero(InputGateToggle[Index]) != 0.0f ? InBuffer[Index] : 0.0f;
+				}
+			}
+		};
+
+		class FPow
+		{
+		public:
+			void ProcessAudioBuffer(const float* InBuffer, float* OutBuffer, const float* InputPowerOf, const int32 InNumSamples)
+			{
+				float inVal, powVal = 0.0f;
+				for (int32 Index = 0; Index < InNumSamples; ++Index)
+				{
+					inVal = InBuffer[Index];
+					powVal = InputPowerOf[Index];
+					if (inVal < 0.0f)
+					{
+						OutBuffer[Index] = -1 * FMath::Pow(FMath::Abs(inVal), powVal);
+					}
+					else
+					{
+						OutBuffer[Index] = FMath::Pow(FMath::Abs(inVal), powVal);
+					}
+				}
+			}
+		};
+
+		class FOnePoleIIR
+		{
+		public:
+			void ProcessAudioBuffer(const float* InBuffer, float* OutBuffer, const float* coefA, const float* coefB, const int32 InNumSamples)
+			{
+				for (int32 Index = 0; Index < InNumSamples; ++Index)
+				{
+					OutBuffer[Index] = InBuffer[Index] * coefB[Index] + mPreviousSample * coefA[Index];
+					mPreviousSample = OutBuffer[Index];
+				}
+			}
+		private:
+			float mPreviousSample = 0.0f;
+		};
+
+		class FOnePoleFIR
+		{
+		public:
+			void ProcessAudioBuffer(const float* InBuffer, float* OutBuffer, const float* coefA, const float* coefB, const int32 InNumSamples)
+			{
+				for (int32 Index = 0; Index < InNumSamples; ++Index)
+				{
+					OutBuffer[Index] = InBuffer[Index] * coefB[Index] + mPreviousInputSample * coefA[Index];
+					mPreviousInputSample = InBuffer[Index];
+				}
+			}
+		private:
+			float mPreviousInputSample = 0.0f;
+		};
+
+		float sReflect(float input)
+		{
+			// changed: the loop never returned for these
+			if (!FMath::IsFinite(input))
+			{
+				return 0.0f;
+			}
+
+			while (input < -1.0f || input > 1.0f)
+			{
+				if (input > 1.0f)
+				{
+					input += ((input - 1.0) * -1.0f) * 2.0f;
+				}
+				else if ((input < -1.0f))
+				{
+					input += ((input + 1.0) * -1.0f) * 2.0f;
+				}
+			}
+
+			return input;
+		}
+
+		class FReflect
+		{
+		public:
+			void ProcessAudioBuffer(const float* InBuffer, float* OutBuffer, const int32 InNumSamples)
+			{
+				for (int32 Index = 0; Index < InNumSamples; ++Index)
+				{
+					OutBuffer[Index] = sReflect(InBuffer[Index]);
+				}
+			}
+		};
+
+		class FRZero
+		{
+		public:
+			float ProcessAudioBuffer(const float* InBuffer, float* OutBuffer, const float InA, const float InPriorSample, const int32 InNumSamples)
+			{
+				float Prior = isnan(InPriorSample) ? InBuffer[0] : InPriorSample;
+				OutBuffer[0] = InBuffer[0] - InA * Prior;
+				for (int32 Index = 1; Index < InNumSamples; ++Index)
+				{
+					OutBuffer[Index] = InBuffer[Index] - InA * InBuffer[Index -1];
+				}
+				return InBuffer[InNumSamples - 1];
+			}
+		};
+
+		class FSamphold
+		{
+		public:
+			void ProcessAudioBuffer(const float* InBuffer, float* OutBuffer, const float* InputSampholdPhasor, const int32 InNumSamples)
+			{
+				for (int32 Index = 0; Index < InNumSamples; ++Index)
+				{
+					if (InputSampholdPhasor[Index] < mPreviousPhasorValue)
+					{
+						mHeldSample = InBuffer[Index];
+					}
+
+					OutBuffer[Index] = mHeldSample;
+					mPreviousPhasorValue = InputSampholdPhasor[Index];
+				}
+			}
+		private:
+			float mHeldSample = 0.0f;
+			float mPreviousPhasorValue = 0.0f;
+		};
+
+		class FSine
+		{
+		public:
+			void ProcessAudioBuffer(const float* InBuffer, float* OutBuffer, const int32 InNumSamples)
+			{
+				for (int32 Index = 0; Index < InNumSamples; ++Index)
+				{
+					OutBuffer[Index] = FMath::Sin((2.0f * PI) * InBuffer[Index]);
+				}
+			}
+		};
+
+		class FSqrt
+		{
+		public:
+			void ProcessAudioBuffer(const float* InBuffer, float* OutBuffer, const int32 InNumSamples)
+			{
+				for (int32 Index = 0; Index < InNumSamples; ++Index)
+				{
+					OutBuffer[Index] = (InBuffer[Index] < 0 ? -1 : 1) * FMath::Sqrt(FMath::Abs(InBuffer[Index]));
+				}
+			}
+		};
+
+		float sWrap(float input)
+		{
+			// changed: the loop never returned for these
+			if (!FMath::IsFinite(input))
+			{
+				return 0.0f;
+			}
+
+			while (input < -1.0f || input > 1.0f)
+			{
+				if (input > 1.0f)
+				{
+					input -= 1.0f;
+				}
+				else if ((input < -1.0f))
+				{
+					input += 1.0f;
+				}
+			}
+
+			return input;
+		}
+
+		class FWrap
+		{
+		public:
+			void ProcessAudioBuffer(const float* InBuffer, float* OutBuffer, const int32 InNumSamples)
+			{
+				for (int32 Index = 0; Index < InNumSamples; ++Index)
+				{
+					OutBuffer[Index] = sWrap(InBuffer[Index]);
+				}
+			}
+		};
+
+		// From the original Compare node's Execute
+		void Compare(const DSPProcessing::EComparison InComparison, const float* InBufferA, const float* InBufferB, float* OutBuffer, const int32 InNumSamples)
+		{
+			for (int32 Index = 0; Index < InNumSamples; ++Index)
+			{
+				const float A = InBufferA[Index];
+				const float B = InBufferB[Index];
+				switch (InComparison)
+				{
+				case DSPProcessing::EComparison::Equals:				OutBuffer[Index] = A == B; break;
+				case DSPProcessing::EComparison::NotEquals:				OutBuffer[Index] = A != B; break;
+				case DSPProcessing::EComparison::LessThan:				OutBuffer[Index] = A < B; break;
+				case DSPProcessing::EComparison::GreaterThan:			OutBuffer[Index] = A > B; break;
+				case DSPProcessing::EComparison::LessThanOrEquals:		OutBuffer[Index] = A <= B; break;
+				case DSPProcessing::EComparison::GreaterThanOrEquals:	OutBuffer[Index] = A >= B; break;
+				}
+			}
+		}
+
+		class CytomicSVF
+		{
+		public:
+			CytomicSVF()
+			{
+				SetLPF();
+			}
+
+			void SetLPF()
+			{
+				m0 = 0.0f;
+				m1 = 0.0f;
+				m2 = 1.0f;
+			}
+
+			void setHPF()
+			{
+				m0 = 1.0f;
+				m1 = -1.0f;
+				m2 = -1.0f;
+			}
+
+			void setBP()
+			{
+				m0 = 0.0f;
+				m1 = 1.0f;
+				m2 = 0.0f;
+			}
+
+			void ProcessAudioBuffer(const float* InBuffer, float* OutBuffer, const float* CutoffFreq, const float* QAmount, const int32 InNumSamples)
+			{
+				for (int i = 0; i < InNumSamples; ++i)
+				{
+					//calc coefficients
+					g = Audio::FastTan(PI * CutoffFreq[i] / fs);
+					k = 1.0f / QAmount[i];
+					a1 = 1.0f / (1.0f + g * (g + k));
+					a2 = g * a1;
+					a3 = g * a2;
+
+					float v3 = InBuffer[i] - ic2eq;
+					float v1 = a1 * ic1eq + a2 * v3;
+					float v2 = ic2eq + a2 * ic1eq + a3 * v3;
+					ic1eq = 2.0f * v1 - ic1eq;
+					ic2eq = 2.0f * v2 - ic2eq;
+
+					// changed: mixed m0 * OutBuffer[i], which fed the high pass its own output
+					OutBuffer[i] = m0 * InBuffer[i] + m1 * k * v1 + m2 * v2;
+				}
+			}
+
+		private:
+			float g = 0.0f, k = 0.0f, a1 = 0.0f, a2 = 0.0f, a3 = 0.0f;  // filter coefficients
+			float m0 = 0.0f, m1 = 0.0f, m2 = 0.0f;
+			float ic1eq = 0.0f, ic2eq = 0.0f;      // internal state
+			const float fs = 48000.0f;
+		};
+	}
+
+	constexpr int32 NumInputs = 4;
+	constexpr int32 NumRandomSamples = 32768;
+
+	// Every input the edge case section sweeps through. Non-finite values come last, so stateful kernels have
+	// compared everything else by the time NaN reaches their state.
+	static const float EdgeValues[] =
+	{
+		0.0f, -0.0f, 1.0e-40f, -1.0e-40f, 1.17549435e-38f, 1.0e-30f,
+		0.49999997f, 0.5f, -0.5f, 1.0f, -1.0f, 1.00000012f, -1.00000012f, 2.0f, -3.0f, 4.5f,
+		1000.0f, -1000.0f, 1000000.25f, 8388609.0f, -8388611.0f, 16777216.0f, 16777218.0f, -33554436.0f,
+		1.0e20f, -1.0e20f, FLT_MAX, -FLT_MAX,
+		INFINITY, -INFINITY, NAN
+	};
+
+	struct FVerifyInputs
+	{
+		TArray<float> Inputs[NumInputs];
+
+		int32 Num() const { return Inputs[0].Num(); }
+		const float* operator[](const int32 InIndex) const { return Inputs[InIndex].GetData(); }
+	};
+
+	using FKernelFunction = void (*)(const FVerifyInputs& InInputs, float* OutBuffer);
+	// True for samples whose inputs the optimized kernel documents as handled differently
+	using FExemptFunction = bool (*)(const FVerifyInputs& InInputs, const int32 InIndex);
+
+	struct FInputRange
+	{
+		float Min;
+		float Max;
+		// a sum of slow sines spanning the range instead of white noise
+		bool bBandLimited = false;
+	};
+
+	struct FVerifyCase
+	{
+		const TCHAR* Name;
+		// random section range of each input
+		FInputRange Ranges[NumInputs];
+		// up to two inputs swept through EdgeValues, every pair is tried when there are two, -1 for none
+		int32 EdgeInputA;
+		int32 EdgeInputB;
+		// edge values past this magnitude are skipped where the reference itself stops being meaningful
+		float MaxEdgeMagnitude;
+		// a finite sample passes within either tolerance
+		float AbsTolerance;
+		int64 UlpTolerance;
+		// Outputs this large count as overflowed, like NaN and Inf. Both sides overflowing passes, whichever way
+		// they did, as the signal is broken either way. One side overflowing fails.
+		float OverflowMagnitude;
+		FKernelFunction Reference;
+		FKernelFunction Optimized;
+		FExemptFunction IsExempt = nullptr;
+		// samples the optimized output lags the reference by
+		int32 Latency = 0;
+	};
+
+	// Writes the interval a kernel's output must stay inside for the given sample, NaN bounds for inputs the
+	// kernel documents as unhandled
+	using FBoundFunction = void (*)(const FVerifyInputs& InInputs, const int32 InIndex, float& OutLow, float& OutHigh);
+
+	// For kernels with no original to match sample for sample. Every output must lie within the bound, which a
+	// NaN or an Inf outside a finite bound never does.
+	struct FBoundCase
+	{
+		const TCHAR* Name;
+		FInputRange Ranges[NumInputs];
+		int32 EdgeInputA;
+		int32 EdgeInputB;
+		float MaxEdgeMagnitude;
+		FBoundFunction Bound;
+		FKernelFunction Optimized;
+	};
+
+	// Feeds a kernel in blocks of varying size so state carried between blocks and every tail length are exercised
+	template<typename FuncType>
+	void ForEachBlock(const int32 InNumSamples, FuncType InFunc)
+	{
+		static const int32 BlockSizes[] = { 480, 1, 7, 64, 333, 2, 4096, 3, 128 };
+
+		int32 Start = 0;
+		for (int32 Block = 0; Start < InNumSamples; ++Block)
+		{
+			const int32 NumSamples = FMath::Min(BlockSizes[Block % UE_ARRAY_COUNT(BlockSizes)], InNumSamples - Start);
+			InFunc(Start, NumSamples);
+			Start += NumSamples;
+		}
+	}
+
+	// Three partials, the highest at 0.072 cycles per sample, so a cubic of the signal still ends below a quarter of
+	// the sample rate and inside the oversampler's passband. Faded in, so filters starting from silence don't ring.
+	constexpr int32 BandLimitedFadeIn = 512;
+
+	float BandLimitedSample(const FInputRange& InRange, const int32 InIndex)
+	{
+		const double Time = 2.0 * UE_DOUBLE_PI * (double)InIndex;
+		const double Fade = InIndex < BandLimitedFadeIn ? 0.5 - 0.5 * FMath::Cos(UE_DOUBLE_PI * (double)InIndex / (double)BandLimitedFadeIn) : 1.0;
+		const double Signal = Fade * (0.5 * FMath::Sin(0.0113 * Time) + 0.3 * FMath::Sin(0.0371 * Time) + 0.2 * FMath::Sin(0.0719 * Time));
+		return (float)(0.5 * ((double)InRange.Max + (double)InRange.Min) + 0.5 * ((double)InRange.Max - (double)InRange.Min) * Signal);
+	}
+
+	void MakeInputs(const FInputRange* InRanges, const int32 InEdgeInputA, const int32 InEdgeInputB, const float InMaxEdgeMagnitude, FVerifyInputs& OutInputs)
+	{
+		FRandomStream Random(22);
+
+		TArray<float> Edges;
+		for (const float Value : EdgeValues)
+		{
+			if (!FMath::IsFinite(Value) || FMath::Abs(Value) <= InMaxEdgeMagnitude)
+			{
+				Edges.Add(Value);
+			}
+		}
+
+		int32 NumEdgeSamples = 0;
+		if (InEdgeInputB >= 0)
+		{
+			NumEdgeSamples = Edges.Num() * Edges.Num();
+		}
+		else if (InEdgeInputA >= 0)
+		{
+			NumEdgeSamples = 4 * Edges.Num();
+		}
+
+		const int32 NumSamples = NumRandomSamples + NumEdgeSamples;
+		for (int32 Input = 0; Input < NumInputs; ++Input)
+		{
+			OutInputs.Inputs[Input].SetNumUninitialized(NumSamples);
+			for (int32 Index = 0; Index < NumSamples; ++Index)
+			{
+				OutInputs.Inputs[Input][Index] = InRanges[Input].bBandLimited ? BandLimitedSample(InRanges[Input], Index) : Random.FRandRange(InRanges[Input].Min, InRanges[Input].Max);
+			}
+		}
+
+		for (int32 Edge = 0; Edge < NumEdgeSamples; ++Edge)
+		{
+			const int32 Index = NumRandomSamples + Edge;
+			if (InEdgeInputB >= 0)
+			{
+				OutInputs.Inputs[InEdgeInputA][Index] = Edges[Edge / Edges.Num()];
+				OutInputs.Inputs[InEdgeInputB][Index] = Edges[Edge % Edges.Num()];
+			}
+			else
+			{
+				// a short run of each, so block-constant paths see it too
+				OutInputs.Inputs[InEdgeInputA][Index] = Edges[Edge / 4];
+			}
+		}
+	}
+
+	// Distance in representable floats, across zero as well
+	int64 UlpDistance(const float InA, const float InB)
+	{
+		auto ToOrdered = [](const float InValue) -> int64
+			{
+				int32 Bits;
+				FMemory::Memcpy(&Bits, &InValue, sizeof(Bits));
+				return Bits < 0 ? (int64)MIN_int32 - (int64)Bits : (int64)Bits;
+			};
+		const int64 Distance = ToOrdered(InA) - ToOrdered(InB);
+		return Distance < 0 ? -Distance : Distance;
+	}
+
+	// Logs the result line for a case, and on a failure the first failing sample, which is also added to OutFailures
+	void LogResult(const TCHAR* InName, const FVerifyInputs& InInputs, const float InMaxError, const TCHAR* InMaxUlpError, const int32 InNumExempt, const int32 InNumFailures,
+		const int32 InFirstFailure, const FString& InFirstFailureDetail, FOutputDevice& Ar, TArray<FString>& OutFailures)
+	{
+		Ar.Logf(TEXT("%-4s %-28s %10.3e %12s %7d %7d"), InNumFailures == 0 ? TEXT("ok") : TEXT("FAIL"), InName, InMaxError, InMaxUlpError, InNumExempt, InNumFailures);
+		if (InFirstFailure != INDEX_NONE)
+		{
+			const FString Failure = FString::Printf(TEXT("%s: %d samples out of tolerance, first at sample %d (%s): inputs %g %g %g %g, %s"), InName, InNumFailures, InFirstFailure,
+				InFirstFailure < NumRandomSamples ? TEXT("random") : TEXT("edge case"),
+				InInputs[0][InFirstFailure], InInputs[1][InFirstFailure], InInputs[2][InFirstFailure], InInputs[3][InFirstFailure], *InFirstFailureDetail);
+			Ar.Logf(TEXT("     %s"), *Failure);
+			OutFailures.Add(Failure);
+		}
+	}
+
+	bool VerifyCase(const FVerifyCase& InCase, FOutputDevice& Ar, TArray<FString>& OutFailures)
+	{
+		FVerifyInputs Inputs;
+		MakeInputs(InCase.Ranges, InCase.EdgeInputA, InCase.EdgeInputB, InCase.MaxEdgeMagnitude, Inputs);
+
+		const int32 NumSamples = Inputs.Num();
+		TArray<float> Expected;
+		TArray<float> Actual;
+		Expected.SetNumZeroed(NumSamples);
+		Actual.SetNumZeroed(NumSamples);
+
+		InCase.Reference(Inputs, Expected.GetData());
+		InCase.Optimized(Inputs, Actual.GetData());
+
+		float MaxAbsError = 0.0f;
+		int64 MaxUlpError = 0;
+		int32 NumFailures = 0;
+		int32 NumExempt = 0;
+		int32 FirstFailure = INDEX_NONE;
+
+		// the last Latency samples of the reference have no optimized output to compare with
+		for (int32 Index = 0; Index + InCase.Latency < NumSamples; ++Index)
+		{
+			if (InCase.IsExempt && InCase.IsExempt(Inputs, Index))
+			{
+				++NumExempt;
+				continue;
+			}
+
+			const float ExpectedValue = Expected[Index];
+			const float ActualValue = Actual[Index + InCase.Latency];
+			bool bPass = true;
+			const bool bExpectedOverflow = !(FMath::Abs(ExpectedValue) < InCase.OverflowMagnitude);
+			const bool bActualOverflow = !(FMath::Abs(ActualValue) < InCase.OverflowMagnitude);
+			if (bExpectedOverflow || bActualOverflow)
+			{
+				bPass = bExpectedOverflow && bActualOverflow;
+			}
+			else
+			{
+				// ULPs only say something away from zero, so they are only counted where the abs tolerance isn't met
+				const float AbsError = FMath::Abs(ExpectedValue - ActualValue);
+				MaxAbsError = FMath::Max(MaxAbsError, AbsError);
+				if (AbsError > InCase.AbsTolerance)
+				{
+					const int64 UlpError = UlpDistance(ExpectedValue, ActualValue);
+					MaxUlpError = FMath::Max(MaxUlpError, UlpError);
+					bPass = UlpError <= InCase.UlpTolerance;
+				}
+			}
+
+			if (!bPass)
+			{
+				++NumFailures;
+				if (FirstFailure == INDEX_NONE)
+				{
+					FirstFailure = Index;
+				}
+			}
+		}
+
+		const FString FirstFailureDetail = FirstFailure == INDEX_NONE ? FString() : FString::Printf(TEXT("expected %.9g, got %.9g"), Expected[FirstFailure], Actual[FirstFailure + InCase.Latency]);
+		LogResult(InCase.Name, Inputs, MaxAbsError, *FString::Printf(TEXT("%lld"), (long long)MaxUlpError), NumExempt, NumFailures, FirstFailure, FirstFailureDetail, Ar, OutFailures);
+		return NumFailures == 0;
+	}
+
+	// The max error column is how far past its bound the output got, 0 for a pass
+	bool VerifyBoundCase(const FBoundCase& InCase, FOutputDevice& Ar, TArray<FString>& OutFailures)
+	{
+		FVerifyInputs Inputs;
+		MakeInputs(InCase.Ranges, InCase.EdgeInputA, InCase.EdgeInputB, InCase.MaxEdgeMagnitude, Inputs);
+
+		const int32 NumSamples = Inputs.Num();
+		TArray<float> Actual;
+		Actual.SetNumZeroed(NumSamples);
+		InCase.Optimized(Inputs, Actual.GetData());
+
+		float MaxExcess = 0.0f;
+		int32 NumFailures = 0;
+		int32 NumExempt = 0;
+		int32 FirstFailure = INDEX_NONE;
+		float FirstLow = 0.0f;
+		float FirstHigh = 0.0f;
+
+		for (int32 Index = 0; Index < NumSamples; ++Index)
+		{
+			float Low;
+			float High;
+			InCase.Bound(Inputs, Index, Low, High);
+			if (FMath::IsNaN(Low) || FMath::IsNaN(High))
+			{
+				++NumExempt;
+				continue;
+			}
+
+			const float Value = Actual[Index];
+			if (Value >= Low && Value <= High)
+			{
+				continue;
+			}
+
+			MaxExcess = FMath::IsNaN(Value) ? INFINITY : FMath::Max(MaxExcess, FMath::Max(Low - Value, Value - High));
+			++NumFailures;
+			if (FirstFailure == INDEX_NONE)
+			{
+				FirstFailure = Index;
+				FirstLow = Low;
+				FirstHigh = High;
+			}
+		}
+
+		const FString FirstFailureDetail = FirstFailure == INDEX_NONE ? FString() : FString::Printf(TEXT("bound [%.9g, %.9g], got %.9g"), FirstLow, FirstHigh, Actual[FirstFailure]);
+		LogResult(InCase.Name, Inputs, MaxExcess, TEXT("-"), NumExempt, NumFailures, FirstFailure, FirstFailureDetail, Ar, OutFailures);
+		return NumFailures == 0;
+	}
+
+	template<DSPProcessing::EComparison Comparison>
+	void ReferenceCompare(const FVerifyInputs& In, float* Out)
+	{
+		Reference::Compare(Comparison, In[0], In[1], Out, In.Num());
+	}
+
+	template<DSPProcessing::EComparison Comparison>
+	void OptimizedCompare(const FVerifyInputs& In, float* Out)
+	{
+		ForEachBlock(In.Num(), [&](const int32 S, const int32 N) { DSPProcessing::FCompare::ProcessAudioBuffer(Comparison, In[0] + S, In[1] + S, Out + S, N); });
+	}
+
+	// The original Select is the original Compare picking between X and Y
+	template<DSPProcessing::EComparison Comparison>
+	void ReferenceSelect(const FVerifyInputs& In, float* Out)
+	{
+		Reference::Compare(Comparison, In[0], In[1], Out, In.Num());
+		for (int32 Index = 0; Index < In.Num(); ++Index)
+		{
+			Out[Index] = Out[Index] != 0.0f ? In[2][Index] : In[3][Index];
+		}
+	}
+
+	template<DSPProcessing::EComparison Comparison>
+	void OptimizedSelect(const FVerifyInputs& In, float* Out)
+	{
+		ForEachBlock(In.Num(), [&](const int32 S, const int32 N) { DSPProcessing::FSelect::ProcessAudioBuffer(Comparison, In[0] + S, In[1] + S, In[2] + S, In[3] + S, Out + S, N); });
+	}
+
+	template<int32 PowerTimes2>
+	void ReferenceConstantPow(const FVerifyInputs& In, float* Out)
+	{
+		TArray<float> Power;
+		Power.Init(0.5f * (float)PowerTimes2, In.Num());
+		Reference::FPow().ProcessAudioBuffer(In[0], Out, Power.GetData(), In.Num());
+	}
+
+	template<int32 PowerTimes2>
+	void OptimizedConstantPow(const FVerifyInputs& In, float* Out)
+	{
+		TArray<float> Power;
+		Power.Init(0.5f * (float)PowerTimes2, In.Num());
+		DSPProcessing::FPow Kernel;
+		ForEachBlock(In.Num(), [&](const int32 S, const int32 N) { Kernel.ProcessAudioBuffer(In[0] + S, Out + S, Power.GetData() + S, N); });
+	}
+
+	// Inputs 1 and 2 are cutoff and Q. From halfway through, each block holds the values its first sample has, so
+	// the optimized filter moves from its modulated path to its block constant one with its state carried over.
+	// The reference gets the same held values.
+	void HoldControlsPerBlock(const FVerifyInputs& In, TArray<float>& OutCutoff, TArray<float>& OutQ)
+	{
+		OutCutoff = In.Inputs[1];
+		OutQ = In.Inputs[2];
+		ForEachBlock(In.Num(), [&](const int32 S, const int32 N)
+			{
+				if (S < In.Num() / 2)
+				{
+					return;
+				}
+				for (int32 Index = S + 1; Index < S + N; ++Index)
+				{
+					OutCutoff[Index] = OutCutoff[S];
+					OutQ[Index] = OutQ[S];
+				}
+			});
+	}
+
+	enum class EVerifyFilterMode : uint8
+	{
+		LowPass,
+		BandPass,
+		HighPass
+	};
+
+	template<EVerifyFilterMode Mode>
+	void ReferenceSVF(const FVerifyInputs& In, float* Out)
+	{
+		TArray<float> Cutoff;
+		TArray<float> Q;
+		HoldControlsPerBlock(In, Cutoff, Q);
+
+		Reference::CytomicSVF Filter;
+		if constexpr (Mode == EVerifyFilterMode::BandPass)
+		{
+			Filter.setBP();
+		}
+		else if constexpr (Mode == EVerifyFilterMode::HighPass)
+		{
+			Filter.setHPF();
+		}
+		Filter.ProcessAudioBuffer(In[0], Out, Cutoff.GetData(), Q.GetData(), In.Num());
+	}
+
+	template<EVerifyFilterMode Mode, bool bUseTanTable>
+	void OptimizedSVF(const FVerifyInputs& In, float* Out)
+	{
+		TArray<float> Cutoff;
+		TArray<float> Q;
+		HoldControlsPerBlock(In, Cutoff, Q);
+
+		DSPProcessing::CytomicSVF Filter;
+		Filter.SetMaxBlockSize(4096);
+		Filter.SetUseTanTable(bUseTanTable);
+		if constexpr (Mode == EVerifyFilterMode::BandPass)
+		{
+			Filter.setBP();
+		}
+		else if constexpr (Mode == EVerifyFilterMode::HighPass)
+		{
+			Filter.setHPF();
+		}
+		ForEachBlock(In.Num(), [&](const int32 S, const int32 N) { Filter.ProcessAudioBuffer(In[0] + S, Out + S, Cutoff.GetData() + S, Q.GetData() + S, N); });
+	}
+
+	template<EVerifyFilterMode Mode>
+	void OptimizedSVFMultimode(const FVerifyInputs& In, float* Out)
+	{
+		TArray<float> Cutoff;
+		TArray<float> Q;
+		HoldControlsPerBlock(In, Cutoff, Q);
+
+		DSPProcessing::CytomicSVF Filter;
+		Filter.SetMaxBlockSize(4096);
+		ForEachBlock(In.Num(), [&](const int32 S, const int32 N)
+			{
+				Filter.ProcessAudioBufferMultimode(In[0] + S, Cutoff.GetData() + S, Q.GetData() + S,
+					Mode == EVerifyFilterMode::LowPass ? Out + S : nullptr,
+					Mode == EVerifyFilterMode::BandPass ? Out + S : nullptr,
+					Mode == EVerifyFilterMode::HighPass ? Out + S : nullptr,
+					nullptr, nullptr, N);
+			});
+	}
+
+	// Cutoff and Q held for the whole run, so the optimized filter takes its static path
+	template<bool bOptimized>
+	void StaticSVF(const FVerifyInputs& In, float* Out)
+	{
+		TArray<float> Cutoff;
+		TArray<float> Q;
+		Cutoff.Init(1234.5f, In.Num());
+		Q.Init(3.0f, In.Num());
+
+		if constexpr (bOptimized)
+		{
+			DSPProcessing::CytomicSVF Filter;
+			Filter.SetMaxBlockSize(4096);
+			ForEachBlock(In.Num(), [&](const int32 S, const int32 N) { Filter.ProcessAudioBuffer(In[0] + S, Out + S, Cutoff.GetData() + S, Q.GetData() + S, N); });
+		}
+		else
+		{
+			Reference::CytomicSVF().ProcessAudioBuffer(In[0], Out, Cutoff.GetData(), Q.GetData(), In.Num());
+		}
+	}
+
+	// A bank of band passes against the sum of separate reference filters
+	constexpr int32 NumBankFilters = 6;
+
+	float BankCutoff(const int32 InFilter) { return 150.0f * FMath::Pow(2.0f, (float)InFilter); }
+	float BankQ(const int32 InFilter) { return 2.0f + (float)InFilter; }
+	float BankGain(const int32 InFilter) { return 1.0f / (float)(InFilter + 1); }
+
+	void ReferenceSVFBank(const FVerifyInputs& In, float* Out)
+	{
+		TArray<float> Band;
+		TArray<float> Cutoff;
+		TArray<float> Q;
+		Band.SetNumUninitialized(In.Num());
+		FMemory::Memzero(Out, In.Num() * sizeof(float));
+
+		for (int32 Filter = 0; Filter < NumBankFilters; ++Filter)
+		{
+			Cutoff.Init(BankCutoff(Filter), In.Num());
+			Q.Init(BankQ(Filter), In.Num());
+			Reference::CytomicSVF BandPass;
+			BandPass.setBP();
+			BandPass.ProcessAudioBuffer(In[0], Band.GetData(), Cutoff.GetData(), Q.GetData(), In.Num());
+			for (int32 Index = 0; Index < In.Num(); ++Index)
+			{
+				Out[Index] += BankGain(Filter) * Band[Index];
+			}
+		}
+	}
+
+	void OptimizedSVFBank(const FVerifyInputs& In, float* Out)
+	{
+		DSPProcessing::FCytomicSVFBank Bank;
+		Bank.SetNumFilters(NumBankFilters);
+		Bank.SetBP();
+		for (int32 Filter = 0; Filter < NumBankFilters; ++Filter)
+		{
+			Bank.SetFilter(Filter, BankCutoff(Filter), BankQ(Filter), BankGain(Filter));
+		}
+		ForEachBlock(In.Num(), [&](const int32 S, const int32 N) { Bank.ProcessAudioBuffer(In[0] + S, Out + S, N); });
+	}
+
+	constexpr FInputRange Audio = { -1.0f, 1.0f };
+	constexpr FInputRange BandLimitedAudio = { -1.0f, 1.0f, true };
+	constexpr FInputRange Loud = { -8.0f, 8.0f };
+	constexpr FInputRange Phase = { -1.0f, 1.0f };
+	constexpr FInputRange Unused = { 0.0f, 0.0f };
+	constexpr float AnyMagnitude = FLT_MAX;
+	constexpr float NoOverflow = INFINITY;
+
+	// The original rounds 2PI * x in float, which costs it ~1e-6 of accuracy by 4 cycles and all of it by 1000.
+	// The optimized kernels reduce the phase first, so they are only compared where the original holds up.
+	constexpr float PhaseMagnitude = 4.5f;
+	// The filters are linear, one huge input only scales their error, so it is checked at audio scale
+	constexpr float FilterMagnitude = 4.5f;
+
+	// FPow saturates short of Inf and reads subnormal bases as 2^-127, so negative powers of tiny bases only
+	// have to agree that they blew up
+	constexpr float PowOverflow = 1.0e18f;
+	// and saturates at FLT_MIN short of 0
+	constexpr float PowUnderflow = 1.0e-30f;
+	// The oversampler's passband ripple on the cube of a full scale band-limited signal, ~1e-4 measured
+	constexpr float OversampledPowTolerance = 2.0e-4f;
+
+	// Past 2^24 the original loops' steps round and Wrap's stops moving, and short of that they take |x| steps.
+	// Those inputs are reduced exactly in double instead, which holds every float.
+	constexpr float LoopMaxMagnitude = 16777216.0f;
+
+	// (1, n] to (0, 1] and [-n, -1) to [-1, 0)
+	double ExactWrap(const double InValue)
+	{
+		return InValue > 0.0 ? InValue - FMath::CeilToDouble(InValue) + 1.0 : InValue - FMath::FloorToDouble(InValue) - 1.0;
+	}
+
+	// A triangle of period 4 through (-1, -1) and (1, 1)
+	double ExactReflect(const double InValue)
+	{
+		double Phase = FMath::Fmod(InValue, 4.0);
+		Phase = Phase < 0.0 ? Phase + 4.0 : Phase;
+		return Phase <= 1.0 ? Phase : (Phase <= 3.0 ? 2.0 - Phase : Phase - 4.0);
+	}
+
+	template<float (*LoopFunction)(float), double (*ExactFunction)(const double)>
+	void ReferenceFold(const FVerifyInputs& In, float* Out)
+	{
+		for (int32 Index = 0; Index < In.Num(); ++Index)
+		{
+			const float Value = In[0][Index];
+			Out[Index] = FMath::IsFinite(Value) && FMath::Abs(Value) > LoopMaxMagnitude ? (float)ExactFunction((double)Value) : LoopFunction(Value);
+		}
+	}
+
+	// Wrap documents 0 past 2^24, where a float has no fraction left to wrap
+	bool IsWrapExempt(const FVerifyInputs& InInputs, const int32 InIndex)
+	{
+		const float Value = InInputs[0][InIndex];
+		return FMath::IsFinite(Value) && FMath::Abs(Value) > LoopMaxMagnitude;
+	}
+
+	// The power goes through the control input, held per group of Factor samples, as the Pow node drives it
+	template<int32 Factor, int32 PowerTimes2>
+	void OversampledConstantPow(const FVerifyInputs& In, float* Out)
+	{
+		TArray<float> Power;
+		Power.Init(0.5f * (float)PowerTimes2, In.Num());
+		DSPProcessing::TOversampled<DSPProcessing::FPow, Factor> Oversampled;
+		Oversampled.SetMaxBlockSize(480);
+		ForEachBlock(In.Num(), [&](const int32 S, const int32 N) { Oversampled.ProcessAudioBuffer(In[0] + S, Out + S, Power.GetData() + S, N); });
+	}
+
+	template<typename KernelType, int32 Factor>
+	void OversampledFold(const FVerifyInputs& In, float* Out)
+	{
+		DSPProcessing::TOversampled<KernelType, Factor> Oversampled;
+		Oversampled.SetMaxBlockSize(480);
+		ForEachBlock(In.Num(), [&](const int32 S, const int32 N) { Oversampled.ProcessAudioBuffer(In[0] + S, Out + S, N); });
+	}
+
+	template<typename KernelType>
+	void ADAAFold(const FVerifyInputs& In, float* Out)
+	{
+		KernelType Kernel;
+		ForEachBlock(In.Num(), [&](const int32 S, const int32 N) { Kernel.ProcessAudioBuffer(In[0] + S, Out + S, N); });
+	}
+
+	void ADAAPow(const FVerifyInputs& In, float* Out)
+	{
+		DSPProcessing::FPowADAA Kernel;
+		ForEachBlock(In.Num(), [&](const int32 S, const int32 N) { Kernel.ProcessAudioBuffer(In[0] + S, Out + S, In[1] + S, N); });
+	}
+
+	// Wrap and Reflect ADAA average a function bounded by 1, whatever the input, and map non-finite input to 0
+	void FoldBound(const FVerifyInputs& /*InInputs*/, const int32 /*InIndex*/, float& OutLow, float& OutHigh)
+	{
+		OutLow = -1.0f;
+		OutHigh = 1.0f;
+	}
+
+	// Oversampled, the down filters can raise that bound by up to the sum of their absolute taps,
+	// 0.5 * (1 + sum of the odd branch) for each halfband stage
+	template<int32 NumTaps>
+	float DownsampleGain()
+	{
+		const float* Taps = DSPProcessing::THalfbandResampler<NumTaps>::GetTaps();
+		float Gain = 1.0f;
+		for (int32 Tap = 0; Tap < NumTaps; ++Tap)
+		{
+			Gain += FMath::Abs(Taps[Tap]);
+		}
+		return 0.5f * Gain;
+	}
+
+	template<int32 Factor>
+	void OversampledFoldBound(const FVerifyInputs& /*InInputs*/, const int32 /*InIndex*/, float& OutLow, float& OutHigh)
+	{
+		// with a little headroom for rounding in the filter sums
+		const float Gain = 1.0001f * (Factor == 2 ? DownsampleGain<32>() : DownsampleGain<32>() * DownsampleGain<12>());
+		OutLow = -Gain;
+		OutHigh = Gain;
+	}
+
+	// ADAA of sign(x) * |x|^p is the average of a rising function between the previous and current input, so it
+	// lies between the two plain results. The room allowed is the pow approximation's error scaled up by the
+	// smallest step that still takes the difference quotient, 1 / 100 of the input. Subnormal and non-finite
+	// operands are exempt, as for FPow.
+	constexpr float PowADAABoundTolerance = 1.0e-3f;
+
+	void PowADAABound(const FVerifyInputs& InInputs, const int32 InIndex, float& OutLow, float& OutHigh)
+	{
+		// the kernel starts from a previous input of 0
+		const float Previous = InIndex > 0 ? InInputs[0][InIndex - 1] : 0.0f;
+		const float Current = InInputs[0][InIndex];
+		const float Power = InInputs[1][InIndex];
+
+		auto IsUsable = [](const float InValue) { return FMath::IsFinite(InValue) && (InValue == 0.0f || FMath::Abs(InValue) >= FLT_MIN); };
+		if (!IsUsable(Previous) || !IsUsable(Current) || !FMath::IsFinite(Power))
+		{
+			OutLow = NAN;
+			OutHigh = NAN;
+			return;
+		}
+
+		auto SignedPow = [Power](const float InValue) { return (InValue < 0.0f ? -1.0 : 1.0) * FMath::Pow(FMath::Abs((double)InValue), (double)Power); };
+		const double Low = FMath::Min(SignedPow(Previous), SignedPow(Current));
+		const double High = FMath::Max(SignedPow(Previous), SignedPow(Current));
+		OutLow = (float)(Low - PowADAABoundTolerance * FMath::Abs(Low));
+		OutHigh = (float)(High + PowADAABoundTolerance * FMath::Abs(High));
+	}
+
+	// FPow doesn't special case subnormal, Inf or NaN operands beyond NaN propagating
+	bool IsPowExempt(const FVerifyInputs& InInputs, const int32 InIndex)
+	{
+		const float Base = FMath::Abs(InInputs[0][InIndex]);
+		const float Power = InInputs[1][InIndex];
+		return (Base > 0.0f && Base < FLT_MIN) || !FMath::IsFinite(Base) || !FMath::IsFinite(Power);
+	}
+
+	// Fast AudioDivide's reciprocal flushes to zero past 2^126, and x / Inf is 0 even for infinite x
+	bool IsFastDivideExempt(const FVerifyInputs& InInputs, const int32 InIndex)
+	{
+		const float Divisor = FMath::Abs(InInputs[1][InIndex]);
+		return Divisor >= 8.50705917e+37f || (Divisor == INFINITY && !FMath::IsFinite(InInputs[0][InIndex]));
+	}
+
+	// Fast AudioDivide counts subnormal divisors as zero
+	void FlushSubnormals(TArray<float>& InOutBuffer)
+	{
+		for (float& Sample : InOutBuffer)
+		{
+			Sample = FMath::Abs(Sample) < FLT_MIN ? 0.0f : Sample;
+		}
+	}
+
+	static const FVerifyCase VerifyCases[] =
+	{
+		{ TEXT("Sine Polynomial"), { Phase, Unused, Unused, Unused }, 0, -1, PhaseMagnitude, 1.0e-6f, 0, NoOverflow,
+			[](const FVerifyInputs& In, float* Out) { Reference::FSine().ProcessAudioBuffer(In[0], Out, In.Num()); },
+			[](const FVerifyInputs& In, float* Out) { DSPProcessing::FSine K; ForEachBlock(In.Num(), [&](const int32 S, const int32 N) { K.ProcessAudioBuffer(In[0] + S, Out + S, N); }); } },
+		{ TEXT("Sine WavetableLinear 512"), { Phase, Unused, Unused, Unused }, 0, -1, PhaseMagnitude, 2.0e-5f, 0, NoOverflow,
+			[](const FVerifyInputs& In, float* Out) { Reference::FSine().ProcessAudioBuffer(In[0], Out, In.Num()); },
+			[](const FVerifyInputs& In, float* Out) { DSPProcessing::FSine K; K.SetMode(DSPProcessing::ESineMode::WavetableLinear, DSPProcessing::ESineTableSize::Size512); ForEachBlock(In.Num(), [&](const int32 S, const int32 N) { K.ProcessAudioBuffer(In[0] + S, Out + S, N); }); } },
+		{ TEXT("Sine WavetableCubic 2048"), { Phase, Unused, Unused, Unused }, 0, -1, PhaseMagnitude, 1.0e-6f, 0, NoOverflow,
+			[](const FVerifyInputs& In, float* Out) { Reference::FSine().ProcessAudioBuffer(In[0], Out, In.Num()); },
+			[](const FVerifyInputs& In, float* Out) { DSPProcessing::FSine K; K.SetMode(DSPProcessing::ESineMode::WavetableCubic, DSPProcessing::ESineTableSize::Size2048); ForEachBlock(In.Num(), [&](const int32 S, const int32 N) { K.ProcessAudioBuffer(In[0] + S, Out + S, N); }); } },
+		{ TEXT("Cos Polynomial"), { Phase, Unused, Unused, Unused }, 0, -1, PhaseMagnitude, 1.0e-6f, 0, NoOverflow,
+			[](const FVerifyInputs& In, float* Out) { Reference::FCos().ProcessAudioBuffer(In[0], Out, In.Num()); },
+			[](const FVerifyInputs& In, float* Out) { DSPProcessing::FCos K; ForEachBlock(In.Num(), [&](const int32 S, const int32 N) { K.ProcessAudioBuffer(In[0] + S, Out + S, N); }); } },
+		{ TEXT("Cos WavetableCubic 8192"), { Phase, Unused, Unused, Unused }, 0, -1, PhaseMagnitude, 1.0e-6f, 0, NoOverflow,
+			[](const FVerifyInputs& In, float* Out) { Reference::FCos().ProcessAudioBuffer(In[0], Out, In.Num()); },
+			[](const FVerifyInputs& In, float* Out) { DSPProcessing::FCos K; K.SetMode(DSPProcessing::ESineMode::WavetableCubic, DSPProcessing::ESineTableSize::Size8192); ForEachBlock(In.Num(), [&](const int32 S, const int32 N) { K.ProcessAudioBuffer(In[0] + S, Out + S, N); }); } },
+		{ TEXT("SinCos Sin"), { Phase, Unused, Unused, Unused }, 0, -1, PhaseMagnitude, 1.0e-6f, 0, NoOverflow,
+			[](const FVerifyInputs& In, float* Out) { Reference::FSine().ProcessAudioBuffer(In[0], Out, In.Num()); },
+			[](const FVerifyInputs& In, float* Out) { DSPProcessing::FSinCos K; TArray<float> Cos; Cos.SetNumUninitialized(In.Num()); ForEachBlock(In.Num(), [&](const int32 S, const int32 N) { K.ProcessAudioBuffer(In[0] + S, Out + S, Cos.GetData() + S, N); }); } },
+		{ TEXT("SinCos Cos"), { Phase, Unused, Unused, Unused }, 0, -1, PhaseMagnitude, 1.0e-6f, 0, NoOverflow,
+			[](const FVerifyInputs& In, float* Out) { Reference::FCos().ProcessAudioBuffer(In[0], Out, In.Num()); },
+			[](const FVerifyInputs& In, float* Out) { DSPProcessing::FSinCos K; TArray<float> Sin; Sin.SetNumUninitialized(In.Num()); ForEachBlock(In.Num(), [&](const int32 S, const int32 N) { K.ProcessAudioBuffer(In[0] + S, Sin.GetData() + S, Out + S, N); }); } },
+		{ TEXT("Pow Modulated"), { Loud, { -2.0f, 4.0f }, Unused, Unused }, 0, 1, AnyMagnitude, PowUnderflow, 64, PowOverflow,
+			[](const FVerifyInputs& In, float* Out) { Reference::FPow().ProcessAudioBuffer(In[0], Out, In[1], In.Num()); },
+			[](const FVerifyInputs& In, float* Out) { DSPProcessing::FPow K; ForEachBlock(In.Num(), [&](const int32 S, const int32 N) { K.ProcessAudioBuffer(In[0] + S, Out + S, In[1] + S, N); }); }, &IsPowExempt },
+		{ TEXT("Pow Constant 2.5"), { Loud, Unused, Unused, Unused }, 0, -1, AnyMagnitude, PowUnderflow, 64, PowOverflow, &ReferenceConstantPow<5>, &OptimizedConstantPow<5>, &IsPowExempt },
+		{ TEXT("Pow Constant -1.5"), { Loud, Unused, Unused, Unused }, 0, -1, AnyMagnitude, PowUnderflow, 64, PowOverflow, &ReferenceConstantPow<-3>, &OptimizedConstantPow<-3>, &IsPowExempt },
+		{ TEXT("Pow Constant 0"), { Loud, Unused, Unused, Unused }, 0, -1, AnyMagnitude, 0.0f, 0, NoOverflow, &ReferenceConstantPow<0>, &OptimizedConstantPow<0> },
+		{ TEXT("Pow Constant 0.5"), { Loud, Unused, Unused, Unused }, 0, -1, AnyMagnitude, 0.0f, 1, NoOverflow, &ReferenceConstantPow<1>, &OptimizedConstantPow<1> },
+		{ TEXT("Pow Constant 1"), { Loud, Unused, Unused, Unused }, 0, -1, AnyMagnitude, 0.0f, 0, NoOverflow, &ReferenceConstantPow<2>, &OptimizedConstantPow<2> },
+		{ TEXT("Pow Constant 2"), { Loud, Unused, Unused, Unused }, 0, -1, AnyMagnitude, 0.0f, 1, NoOverflow, &ReferenceConstantPow<4>, &OptimizedConstantPow<4> },
+		{ TEXT("Pow Constant 3"), { Loud, Unused, Unused, Unused }, 0, -1, AnyMagnitude, 0.0f, 1, NoOverflow, &ReferenceConstantPow<6>, &OptimizedConstantPow<6> },
+		{ TEXT("Pow Constant 4"), { Loud, Unused, Unused, Unused }, 0, -1, AnyMagnitude, 0.0f, 2, NoOverflow, &ReferenceConstantPow<8>, &OptimizedConstantPow<8> },
+		{ TEXT("Sqrt Precise"), { Loud, Unused, Unused, Unused }, 0, -1, AnyMagnitude, 0.0f, 0, NoOverflow,
+			[](const FVerifyInputs& In, float* Out) { Reference::FSqrt().ProcessAudioBuffer(In[0], Out, In.Num()); },
+			[](const FVerifyInputs& In, float* Out) { DSPProcessing::FSqrt K; ForEachBlock(In.Num(), [&](const int32 S, const int32 N) { K.ProcessAudioBuffer(In[0] + S, Out + S, N); }); } },
+		{ TEXT("Sqrt Fast"), { Loud, Unused, Unused, Unused }, 0, -1, AnyMagnitude, 1.0e-19f, 1024, NoOverflow,
+			[](const FVerifyInputs& In, float* Out) { Reference::FSqrt().ProcessAudioBuffer(In[0], Out, In.Num()); },
+			[](const FVerifyInputs& In, float* Out) { DSPProcessing::FSqrt K; K.SetAccuracy(DSPProcessing::EAccuracy::Fast); ForEachBlock(In.Num(), [&](const int32 S, const int32 N) { K.ProcessAudioBuffer(In[0] + S, Out + S, N); }); } },
+		{ TEXT("Pow Oversampled 2x"), { BandLimitedAudio, Unused, Unused, Unused }, -1, -1, AnyMagnitude, OversampledPowTolerance, 0, NoOverflow,
+			&ReferenceConstantPow<6>, &OversampledConstantPow<2, 6>, nullptr, DSPProcessing::TOversampler<2>::Latency },
+		{ TEXT("Pow Oversampled 4x"), { BandLimitedAudio, Unused, Unused, Unused }, -1, -1, AnyMagnitude, OversampledPowTolerance, 0, NoOverflow,
+			&ReferenceConstantPow<6>, &OversampledConstantPow<4, 6>, nullptr, DSPProcessing::TOversampler<4>::Latency },
+		{ TEXT("Wrap"), { { -50.0f, 50.0f }, Unused, Unused, Unused }, 0, -1, AnyMagnitude, 0.0f, 0, NoOverflow,
+			&ReferenceFold<&Reference::sWrap, &ExactWrap>,
+			[](const FVerifyInputs& In, float* Out) { DSPProcessing::FWrap K; ForEachBlock(In.Num(), [&](const int32 S, const int32 N) { K.ProcessAudioBuffer(In[0] + S, Out + S, N); }); }, &IsWrapExempt },
+		{ TEXT("Reflect"), { { -50.0f, 50.0f }, Unused, Unused, Unused }, 0, -1, AnyMagnitude, 0.0f, 0, NoOverflow,
+			&ReferenceFold<&Reference::sReflect, &ExactReflect>,
+			[](const FVerifyInputs& In, float* Out) { DSPProcessing::FReflect K; ForEachBlock(In.Num(), [&](const int32 S, const int32 N) { K.ProcessAudioBuffer(In[0] + S, Out + S, N); }); } },
+		{ TEXT("AudioDivide Precise"), { Loud, Loud, Unused, Unused }, 0, 1, AnyMagnitude, 0.0f, 0, NoOverflow,
+			[](const FVerifyInputs& In, float* Out) { Reference::FAudioDivide().ProcessAudioBuffer(In[0], Out, In[1], In.Num()); },
+			[](const FVerifyInputs& In, float* Out) { DSPProcessing::FAudioDivide K; ForEachBlock(In.Num(), [&](const int32 S, const int32 N) { K.ProcessAudioBuffer(In[0] + S, Out + S, In[1] + S, N); }); } },
+		{ TEXT("AudioDivide Fast"), { Loud, Loud, Unused, Unused }, 0, 1, AnyMagnitude, 1.0e-30f, 1024, NoOverflow,
+			[](const FVerifyInputs& In, float* Out) { TArray<float> Divisor(In.Inputs[1]); FlushSubnormals(Divisor); Reference::FAudioDivide().ProcessAudioBuffer(In[0], Out, Divisor.GetData(), In.Num()); },
+			[](const FVerifyInputs& In, float* Out) { DSPProcessing::FAudioDivide K; K.SetAccuracy(DSPProcessing::EAccuracy::Fast); ForEachBlock(In.Num(), [&](const int32 S, const int32 N) { K.ProcessAudioBuffer(In[0] + S, Out + S, In[1] + S, N); }); }, &IsFastDivideExempt },
+		{ TEXT("Compare Equals"), { Audio, Audio, Unused, Unused }, 0, 1, AnyMagnitude, 0.0f, 0, NoOverflow, &ReferenceCompare<DSPProcessing::EComparison::Equals>, &OptimizedCompare<DSPProcessing::EComparison::Equals> },
+		{ TEXT("Compare NotEquals"), { Audio, Audio, Unused, Unused }, 0, 1, AnyMagnitude, 0.0f, 0, NoOverflow, &ReferenceCompare<DSPProcessing::EComparison::NotEquals>, &OptimizedCompare<DSPProcessing::EComparison::NotEquals> },
+		{ TEXT("Compare LessThan"), { Audio, Audio, Unused, Unused }, 0, 1, AnyMagnitude, 0.0f, 0, NoOverflow, &ReferenceCompare<DSPProcessing::EComparison::LessThan>, &OptimizedCompare<DSPProcessing::EComparison::LessThan> },
+		{ TEXT("Compare GreaterThan"), { Audio, Audio, Unused, Unused }, 0, 1, AnyMagnitude, 0.0f, 0, NoOverflow, &ReferenceCompare<DSPProcessing::EComparison::GreaterThan>, &OptimizedCompare<DSPProcessing::EComparison::GreaterThan> },
+		{ TEXT("Compare LessThanOrEquals"), { Audio, Audio, Unused, Unused }, 0, 1, AnyMagnitude, 0.0f, 0, NoOverflow, &ReferenceCompare<DSPProcessing::EComparison::LessThanOrEquals>, &OptimizedCompare<DSPProcessing::EComparison::LessThanOrEquals> },
+		{ TEXT("Compare GreaterThanOrEquals"), { Audio, Audio, Unused, Unused }, 0, 1, AnyMagnitude, 0.0f, 0, NoOverflow, &ReferenceCompare<DSPProcessing::EComparison::GreaterThanOrEquals>, &OptimizedCompare<DSPProcessing::EComparison::GreaterThanOrEquals> },
+		{ TEXT("Select Equals"), { Audio, Audio, Audio, Audio }, 0, 1, AnyMagnitude, 0.0f, 0, NoOverflow, &ReferenceSelect<DSPProcessing::EComparison::Equals>, &OptimizedSelect<DSPProcessing::EComparison::Equals> },
+		{ TEXT("Select LessThan"), { Audio, Audio, Audio, Audio }, 0, 1, AnyMagnitude, 0.0f, 0, NoOverflow, &ReferenceSelect<DSPProcessing::EComparison::LessThan>, &OptimizedSelect<DSPProcessing::EComparison::LessThan> },
+		{ TEXT("Select GreaterThanOrEquals"), { Audio, Audio, Audio, Audio }, 0, 1, AnyMagnitude, 0.0f, 0, NoOverflow, &ReferenceSelect<DSPProcessing::EComparison::GreaterThanOrEquals>, &OptimizedSelect<DSPProcessing::EComparison::GreaterThanOrEquals> },
+		{ TEXT("Gate"), { Audio, { -1.5f, 1.5f }, Unused, Unused }, 0, 1, AnyMagnitude, 0.0f, 0, NoOverflow,
+			[](const FVerifyInputs& In, float* Out) { Reference::FGate().ProcessAudioBuffer(In[0], Out, In[1], In.Num()); },
+			[](const FVerifyInputs& In, float* Out) { DSPProcessing::FGate K; ForEachBlock(In.Num(), [&](const int32 S, const int32 N) { K.ProcessAudioBuffer(In[0] + S, Out + S, In[1] + S, N); }); } },
+		{ TEXT("OnePoleIIR Modulated"), { Audio, { 0.0f, 0.999f }, { 0.0f, 1.0f }, Unused }, 0, -1, FilterMagnitude, 2.0e-6f, 0, NoOverflow,
+			[](const FVerifyInputs& In, float* Out) { Reference::FOnePoleIIR().ProcessAudioBuffer(In[0], Out, In[1], In[2], In.Num()); },
+			[](const FVerifyInputs& In, float* Out) { DSPProcessing::FOnePoleIIR K; ForEachBlock(In.Num(), [&](const int32 S, const int32 N) { K.ProcessAudioBuffer(In[0] + S, Out + S, In[1] + S, In[2] + S, N); }); } },
+		{ TEXT("OnePoleIIR Constant"), { Audio, Unused, Unused, Unused }, 0, -1, FilterMagnitude, 2.0e-6f, 0, NoOverflow,
+			[](const FVerifyInputs& In, float* Out) { TArray<float> A, B; A.Init(0.995f, In.Num()); B.Init(0.005f, In.Num()); Reference::FOnePoleIIR().ProcessAudioBuffer(In[0], Out, A.GetData(), B.GetData(), In.Num()); },
+			[](const FVerifyInputs& In, float* Out) { TArray<float> A, B; A.Init(0.995f, In.Num()); B.Init(0.005f, In.Num()); DSPProcessing::FOnePoleIIR K; ForEachBlock(In.Num(), [&](const int32 S, const int32 N) { K.ProcessAudioBuffer(In[0] + S, Out + S, A.GetData() + S, B.GetData() + S, N); }); } },
+		{ TEXT("OnePoleFIR Modulated"), { Audio, Audio, Audio, Unused }, 0, -1, FilterMagnitude, 1.0e-6f, 0, NoOverflow,
+			[](const FVerifyInputs& In, float* Out) { Reference::FOnePoleFIR().ProcessAudioBuffer(In[0], Out, In[1], In[2], In.Num()); },
+			[](const FVerifyInputs& In, float* Out) { DSPProcessing::FOnePoleFIR K; ForEachBlock(In.Num(), [&](const int32 S, const int32 N) { K.ProcessAudioBuffer(In[0] + S, Out + S, In[1] + S, In[2] + S, N); }); } },
+		{ TEXT("OnePoleFIR Constant"), { Audio, Unused, Unused, Unused }, 0, -1, FilterMagnitude, 1.0e-6f, 0, NoOverflow,
+			[](const FVerifyInputs& In, float* Out) { TArray<float> A, B; A.Init(0.5f, In.Num()); B.Init(0.5f, In.Num()); Reference::FOnePoleFIR().ProcessAudioBuffer(In[0], Out, A.GetData(), B.GetData(), In.Num()); },
+			[](const FVerifyInputs& In, float* Out) { TArray<float> A, B; A.Init(0.5f, In.Num()); B.Init(0.5f, In.Num()); DSPProcessing::FOnePoleFIR K; ForEachBlock(In.Num(), [&](const int32 S, const int32 N) { K.ProcessAudioBuffer(In[0] + S, Out + S, A.GetData() + S, B.GetData() + S, N); }); } },
+		{ TEXT("RZero"), { Audio, Unused, Unused, Unused }, 0, -1, AnyMagnitude, 0.0f, 0, NoOverflow,
+			[](const FVerifyInputs& In, float* Out) { Reference::FRZero().ProcessAudioBuffer(In[0], Out, 0.95f, 0.0f, In.Num()); },
+			[](const FVerifyInputs& In, float* Out) { DSPProcessing::FRZero K; float Prior = 0.0f; ForEachBlock(In.Num(), [&](const int32 S, const int32 N) { Prior = K.ProcessAudioBuffer(In[0] + S, Out + S, 0.95f, Prior, N); }); } },
+		{ TEXT("Samphold"), { Audio, { 0.0f, 1.0f }, Unused, Unused }, 0, 1, AnyMagnitude, 0.0f, 0, NoOverflow,
+			[](const FVerifyInputs& In, float* Out) { Reference::FSamphold().ProcessAudioBuffer(In[0], Out, In[1], In.Num()); },
+			[](const FVerifyInputs& In, float* Out) { DSPProcessing::FSamphold K; ForEachBlock(In.Num(), [&](const int32 S, const int32 N) { K.ProcessAudioBuffer(In[0] + S, Out + S, In[1] + S, N); }); } },
+		{ TEXT("VCF LowPass Modulated"), { Audio, { 20.0f, 20000.0f }, { 0.5f, 10.0f }, Unused }, 0, -1, FilterMagnitude, 1.0e-5f, 0, NoOverflow, &ReferenceSVF<EVerifyFilterMode::LowPass>, &OptimizedSVF<EVerifyFilterMode::LowPass, false> },
+		{ TEXT("VCF BandPass Modulated"), { Audio, { 20.0f, 20000.0f }, { 0.5f, 10.0f }, Unused }, 0, -1, FilterMagnitude, 1.0e-5f, 0, NoOverflow, &ReferenceSVF<EVerifyFilterMode::BandPass>, &OptimizedSVF<EVerifyFilterMode::BandPass, false> },
+		{ TEXT("VCF HighPass Modulated"), { Audio, { 20.0f, 20000.0f }, { 0.5f, 10.0f }, Unused }, 0, -1, FilterMagnitude, 1.0e-5f, 0, NoOverflow, &ReferenceSVF<EVerifyFilterMode::HighPass>, &OptimizedSVF<EVerifyFilterMode::HighPass, false> },
+		{ TEXT("VCF LowPass TanTable"), { Audio, { 20.0f, 20000.0f }, { 0.5f, 10.0f }, Unused }, 0, -1, FilterMagnitude, 2.0e-5f, 0, NoOverflow, &ReferenceSVF<EVerifyFilterMode::LowPass>, &OptimizedSVF<EVerifyFilterMode::LowPass, true> },
+		{ TEXT("VCF LowPass Static"), { Audio, Unused, Unused, Unused }, 0, -1, FilterMagnitude, 1.0e-5f, 0, NoOverflow, &StaticSVF<false>, &StaticSVF<true> },
+		{ TEXT("VCF Multimode Low"), { Audio, { 20.0f, 20000.0f }, { 0.5f, 10.0f }, Unused }, 0, -1, FilterMagnitude, 1.0e-5f, 0, NoOverflow, &ReferenceSVF<EVerifyFilterMode::LowPass>, &OptimizedSVFMultimode<EVerifyFilterMode::LowPass> },
+		{ TEXT("VCF Multimode Band"), { Audio, { 20.0f, 20000.0f }, { 0.5f, 10.0f }, Unused }, 0, -1, FilterMagnitude, 1.0e-5f, 0, NoOverflow, &ReferenceSVF<EVerifyFilterMode::BandPass>, &OptimizedSVFMultimode<EVerifyFilterMode::BandPass> },
+		{ TEXT("VCF Multimode High"), { Audio, { 20.0f, 20000.0f }, { 0.5f, 10.0f }, Unused }, 0, -1, FilterMagnitude, 1.0e-5f, 0, NoOverflow, &ReferenceSVF<EVerifyFilterMode::HighPass>, &OptimizedSVFMultimode<EVerifyFilterMode::HighPass> },
+		{ TEXT("VCF Bank BandPass"), { Audio, Unused, Unused, Unused }, 0, -1, FilterMagnitude, 2.0e-6f, 0, NoOverflow, &ReferenceSVFBank, &OptimizedSVFBank },
+	};
+
+	static const FBoundCase BoundCases[] =
+	{
+		{ TEXT("Wrap ADAA"), { { -50.0f, 50.0f }, Unused, Unused, Unused }, 0, -1, AnyMagnitude, &FoldBound, &ADAAFold<DSPProcessing::FWrapADAA> },
+		{ TEXT("Reflect ADAA"), { { -50.0f, 50.0f }, Unused, Unused, Unused }, 0, -1, AnyMagnitude, &FoldBound, &ADAAFold<DSPProcessing::FReflectADAA> },
+		{ TEXT("Pow ADAA"), { Loud, { 0.25f, 4.0f }, Unused, Unused }, 0, -1, AnyMagnitude, &PowADAABound, &ADAAPow },
+		{ TEXT("Wrap Oversampled 2x"), { { -50.0f, 50.0f }, Unused, Unused, Unused }, 0, -1, AnyMagnitude, &OversampledFoldBound<2>, &OversampledFold<DSPProcessing::FWrap, 2> },
+		{ TEXT("Wrap Oversampled 4x"), { { -50.0f, 50.0f }, Unused, Unused, Unused }, 0, -1, AnyMagnitude, &OversampledFoldBound<4>, &OversampledFold<DSPProcessing::FWrap, 4> },
+		{ TEXT("Reflect Oversampled 2x"), { { -50.0f, 50.0f }, Unused, Unused, Unused }, 0, -1, AnyMagnitude, &OversampledFoldBound<2>, &OversampledFold<DSPProcessing::FReflect, 2> },
+		{ TEXT("Reflect Oversampled 4x"), { { -50.0f, 50.0f }, Unused, Unused, Unused }, 0, -1, AnyMagnitude, &OversampledFoldBound<4>, &OversampledFold<DSPProcessing::FReflect, 4> },
+	};
+
+	// Runs the cases whose name contains InFilter, all of them for an empty filter, logging a line for each.
+	// A description of each case out of tolerance is added to OutFailures. Returns the number of cases run.
+	int32 RunVerification(const FString& InFilter, FOutputDevice& Ar, TArray<FString>& OutFailures)
+	{
+		auto IsFiltered = [&InFilter](const TCHAR* InName) { return !InFilter.IsEmpty() && FCString::Stristr(InName, *InFilter) == nullptr; };
+
+		Ar.Logf(TEXT("Optimized kernels against the original scalar kernels, %d random samples plus edge cases each"), NumRandomSamples);
+		Ar.Logf(TEXT("%-4s %-28s %10s %12s %7s %7s"), TEXT(""), TEXT("Kernel"), TEXT("Max abs"), TEXT("Max ULP"), TEXT("Exempt"), TEXT("Fails"));
+
+		int32 NumCases = 0;
+		int32 NumFailedCases = 0;
+		for (const FVerifyCase& Case : VerifyCases)
+		{
+			if (!IsFiltered(Case.Name))
+			{
+				++NumCases;
+				NumFailedCases += VerifyCase(Case, Ar, OutFailures) ? 0 : 1;
+			}
+		}
+
+		Ar.Logf(TEXT("Kernels without an original, against the bounds of their output"));
+		Ar.Logf(TEXT("%-4s %-28s %10s %12s %7s %7s"), TEXT(""), TEXT("Kernel"), TEXT("Max excess"), TEXT(""), TEXT("Exempt"), TEXT("Fails"));
+
+		for (const FBoundCase& Case : BoundCases)
+		{
+			if (!IsFiltered(Case.Name))
+			{
+				++NumCases;
+				NumFailedCases += VerifyBoundCase(Case, Ar, OutFailures) ? 0 : 1;
+			}
+		}
+
+		Ar.Logf(TEXT("%d of %d kernels within tolerance"), NumCases - NumFailedCases, NumCases);
+		return NumCases;
+	}
+
+	void VerifyKernels(const TArray<FString>& Args, FOutputDevice& Ar)
+	{
+		TArray<FString> Failures;
+		RunVerification(Args.Num() > 0 ? Args[0] : FString(), Ar, Failures);
+	}
+
+	static FAutoConsoleCommandWithArgsAndOutputDevice VerifyKernelsCommand(
+		TEXT("au.MathUtils.VerifyKernels"),
+		TEXT("Checks the optimized DSPProcessing kernels against the original scalar kernels within per-kernel tolerances. Optional argument: kernel name filter."),
+		FConsoleCommandWithArgsAndOutputDeviceDelegate::CreateStatic(&VerifyKernels));
+}
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMetasoundsAudioMathUtilsVerifyKernelsTest, "Audio.MetasoundsAudioMathUtils.VerifyKernels", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FMetasoundsAudioMathUtilsVerifyKernelsTest::RunTest(const FString& Parameters)
+{
+	TArray<FString> Failures;
+	const int32 NumCases = MetasoundsAudioMathUtilsVerification::RunVerification(Parameters, *GLog, Failures);
+	for (const FString& Failure : Failures)
+	{
+		AddError(Failure);
+	}
+	return TestTrue(TEXT("Some kernel cases ran"), NumCases > 0) && Failures.IsEmpty();
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
+
+#endif // !UE_BUILD_SHIPPING
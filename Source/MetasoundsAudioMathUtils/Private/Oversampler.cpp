@@ -0,0 +1,198 @@
+// Copyright Christopher Wratt 2024.
+// All code under MIT license: see https://mit-license.org/
+
+#include "Oversampler.h"
+#include "Math/UnrealMathUtility.h"
+#include "Math/VectorRegister.h"
+
+namespace DSPProcessing
+{
+
+// Zeroth order modified Bessel function of the first kind, for the Kaiser window
+static double BesselI0(const double InX)
+{
+	double Sum = 1.0;
+	double Term = 1.0;
+	for (int32 Index = 1; Index < 50; ++Index)
+	{
+		const double Ratio = InX / (2.0 * (double)Index);
+		Term *= Ratio * Ratio;
+		Sum += Term;
+	}
+	return Sum;
+}
+
+// Odd taps of a halfband of length 2 * InNumTaps - 1, i.e. sinc(j / 2) at odd j, Kaiser windowed and scaled
+// so they sum to 1. Scaled that way they are the upsampler's odd branch as is, the downsampler halves them.
+static TArray<float> MakeHalfbandTaps(const int32 InNumTaps, const double InBeta)
+{
+	TArray<double> Taps;
+	Taps.SetNumUninitialized(InNumTaps);
+
+	double Sum = 0.0;
+	for (int32 Tap = 0; Tap < InNumTaps; ++Tap)
+	{
+		const double Offset = (double)(2 * Tap - InNumTaps + 1);
+		const double Window = BesselI0(InBeta * FMath::Sqrt(1.0 - FMath::Square(Offset / (double)InNumTaps))) / BesselI0(InBeta);
+		const double Phase = UE_DOUBLE_PI * Offset * 0.5;
+		Taps[Tap] = FMath::Sin(Phase) / Phase * Window;
+		Sum += Taps[Tap];
+	}
+
+	TArray<float> Normalized;
+	Normalized.SetNumUninitialized(InNumTaps);
+	for (int32 Tap = 0; Tap < InNumTaps; ++Tap)
+	{
+		Normalized[Tap] = (float)(Taps[Tap] / Sum);
+	}
+	return Normalized;
+}
+
+template<int32 NumTaps>
+const float* THalfbandResampler<NumTaps>::GetTaps()
+{
+	// beta 8 gives ~80dB once the transition band is cleared, 7 is plenty for the short inner stage
+	static const TArray<float> Taps = MakeHalfbandTaps(NumTaps, NumTaps >= 32 ? 8.0 : 7.0);
+	return Taps.GetData();
+}
+
+template<int32 NumTaps>
+void THalfbandResampler<NumTaps>::SetMaxBlockSize(const int32 InMaxNumSamples)
+{
+	// zeroed so the first block reads silence as history, growing keeps the history already there
+	UpInput.SetNumZeroed(NumTaps - 1 + InMaxNumSamples);
+	DownEven.SetNumZeroed(Latency + InMaxNumSamples);
+	DownOdd.SetNumZeroed(NumTaps + InMaxNumSamples);
+}
+
+template<int32 NumTaps>
+void THalfbandResampler<NumTaps>::Reset()
+{
+	FMemory::Memzero(UpInput.GetData(), UpInput.Num() * sizeof(float));
+	FMemory::Memzero(DownEven.GetData(), DownEven.Num() * sizeof(float));
+	FMemory::Memzero(DownOdd.GetData(), DownOdd.Num() * sizeof(float));
+}
+
+template<int32 NumTaps>
+void THalfbandResampler<NumTaps>::Upsample(const float* InBuffer, float* OutBuffer, const int32 InNumSamples)
+{
+	constexpr int32 HistoryLength = NumTaps - 1;
+
+	if (UpInput.Num() < HistoryLength + InNumSamples)
+	{
+		SetMaxBlockSize(InNumSamples);
+	}
+
+	float* Input = UpInput.GetData();
+	FMemory::Memcpy(Input + HistoryLength, InBuffer, InNumSamples * sizeof(float));
+
+	const float* Taps = GetTaps();
+	VectorRegister4Float TapVectors[NumTaps / 2];
+	for (int32 Tap = 0; Tap < NumTaps / 2; ++Tap)
+	{
+		TapVectors[Tap] = VectorSetFloat1(Taps[Tap]);
+	}
+
+	// Even output 2n is input n - Latency, odd output 2n + 1 is the FIR over inputs n - NumTaps + 1 .. n.
+	// Four consecutive n at a time, each tap scales a shifted load, so there is no horizontal add.
+	// The taps are symmetric, so mirrored inputs are added first and only half the taps multiply.
+	int32 Index = 0;
+	for (; Index + 4 <= InNumSamples; Index += 4)
+	{
+		const float* Window = Input + Index;
+		VectorRegister4Float Odd = VectorMultiply(TapVectors[0], VectorAdd(VectorLoad(Window), VectorLoad(Window + NumTaps - 1)));
+		for (int32 Tap = 1; Tap < NumTaps / 2; ++Tap)
+		{
+			Odd = VectorMultiplyAdd(TapVectors[Tap], VectorAdd(VectorLoad(Window + Tap), VectorLoad(Window + NumTaps - 1 - Tap)), Odd);
+		}
+		const VectorRegister4Float Even = VectorLoad(Window + Latency - 1);
+
+		VectorStore(VectorSwizzle(VectorShuffle(Even, Odd, 0, 1, 0, 1), 0, 2, 1, 3), OutBuffer + 2 * Index);
+		VectorStore(VectorSwizzle(VectorShuffle(Even, Odd, 2, 3, 2, 3), 0, 2, 1, 3), OutBuffer + 2 * Index + 4);
+	}
+
+	for (; Index < InNumSamples; ++Index)
+	{
+		const float* Window = Input + Index;
+		float Odd = 0.0f;
+		for (int32 Tap = 0; Tap < NumTaps; ++Tap)
+		{
+			Odd += Taps[Tap] * Window[Tap];
+		}
+		OutBuffer[2 * Index] = Window[Latency - 1];
+		OutBuffer[2 * Index + 1] = Odd;
+	}
+
+	FMemory::Memmove(Input, Input + InNumSamples, HistoryLength * sizeof(float));
+}
+
+template<int32 NumTaps>
+void THalfbandResampler<NumTaps>::Downsample(const float* InBuffer, float* OutBuffer, const int32 InNumSamples)
+{
+	constexpr int32 EvenHistory = Latency;
+	constexpr int32 OddHistory = NumTaps;
+
+	if (DownOdd.Num() < OddHistory + InNumSamples)
+	{
+		SetMaxBlockSize(InNumSamples);
+	}
+
+	float* Even = DownEven.GetData();
+	float* Odd = DownOdd.GetData();
+
+	// split into the two polyphase branches
+	int32 Index = 0;
+	for (; Index + 4 <= InNumSamples; Index += 4)
+	{
+		const VectorRegister4Float Low = VectorLoad(InBuffer + 2 * Index);
+		const VectorRegister4Float High = VectorLoad(InBuffer + 2 * Index + 4);
+		VectorStore(VectorShuffle(Low, High, 0, 2, 0, 2), Even + EvenHistory + Index);
+		VectorStore(VectorShuffle(Low, High, 1, 3, 1, 3), Odd + OddHistory + Index);
+	}
+	for (; Index < InNumSamples; ++Index)
+	{
+		Even[EvenHistory + Index] = InBuffer[2 * Index];
+		Odd[OddHistory + Index] = InBuffer[2 * Index + 1];
+	}
+
+	const float* Taps = GetTaps();
+	VectorRegister4Float TapVectors[NumTaps / 2];
+	for (int32 Tap = 0; Tap < NumTaps / 2; ++Tap)
+	{
+		TapVectors[Tap] = VectorSetFloat1(Taps[Tap]);
+	}
+	const VectorRegister4Float Half = VectorSetFloat1(0.5f);
+
+	// Out n = 0.5 * (even input n - Latency + FIR over odd inputs n - NumTaps .. n - 1)
+	Index = 0;
+	for (; Index + 4 <= InNumSamples; Index += 4)
+	{
+		const float* Window = Odd + Index;
+		VectorRegister4Float Sum = VectorMultiplyAdd(TapVectors[0], VectorAdd(VectorLoad(Window), VectorLoad(Window + NumTaps - 1)), VectorLoad(Even + Index));
+		for (int32 Tap = 1; Tap < NumTaps / 2; ++Tap)
+		{
+			Sum = VectorMultiplyAdd(TapVectors[Tap], VectorAdd(VectorLoad(Window + Tap), VectorLoad(Window + NumTaps - 1 - Tap)), Sum);
+		}
+		VectorStore(VectorMultiply(Sum, Half), OutBuffer + Index);
+	}
+
+	for (; Index < InNumSamples; ++Index)
+	{
+		const float* Window = Odd + Index;
+		float Sum = Even[Index];
+		for (int32 Tap = 0; Tap < NumTaps; ++Tap)
+		{
+			Sum += Taps[Tap] * Window[Tap];
+		}
+		OutBuffer[Index] = 0.5f * Sum;
+	}
+
+	FMemory::Memmove(Even, Even + InNumSamples, EvenHistory * sizeof(float));
+	FMemory::Memmove(Odd, Odd + InNumSamples, OddHistory * sizeof(float));
+}
+
+// the two stages TOversampler uses
+template class THalfbandResampler<12>;
+template class THalfbandResampler<32>;
+
+} // namespace DSPProcessing
@@ -0,0 +1,93 @@
+// Copyright Christopher Wratt 2024.
+// All code under MIT license: see https://mit-license.org/
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "AudioUtils.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace MetasoundsAudioMathUtilsTests
+{
+	// Around the units boundary, at and just past 2^24 where float loses its fractional part, the largest float
+	// and the non-finite values. An odd count so the last few go through the kernels' tail handling.
+	static const float WrapReflectEdgeValues[] =
+	{
+		0.0f, -0.0f, 1.0f, -1.0f, 1.00000012f, -1.00000012f, 1.5f, -1.5f, 2.0f, -2.0f, 3.0f, -3.0f, 4.25f, -4.25f,
+		1000000.5f, -1000000.5f, 8388607.5f, -8388607.5f, 8388609.0f, -8388609.0f,
+		16777215.0f, -16777215.0f, 16777216.0f, -16777216.0f, 16777218.0f, -16777218.0f, 16777220.0f, -16777220.0f,
+		1.0e20f, -1.0e20f, FLT_MAX, -FLT_MAX, INFINITY, -INFINITY, NAN
+	};
+
+	// (1, n] wraps into (0, 1] and [-n, -1) into [-1, 0), in double so it doesn't share the kernel's rounding.
+	// Non-finite inputs and anything past 2^24 are documented to return 0.
+	float ExpectedWrap(const float InValue)
+	{
+		const double Value = (double)InValue;
+		if (FMath::Abs(Value) <= 1.0)
+		{
+			return InValue;
+		}
+		if (!(FMath::Abs(Value) <= 16777216.0))
+		{
+			return 0.0f;
+		}
+		return (float)(Value > 0.0 ? Value - FMath::CeilToDouble(Value) + 1.0 : Value - FMath::FloorToDouble(Value) - 1.0);
+	}
+
+	// A triangle wave of period 4 through (0, 0), (1, 1) and (3, -1). Fmod is exact for any float input, where
+	// adding anything first would round. Non-finite inputs return 0.
+	float ExpectedReflect(const float InValue)
+	{
+		const double Value = (double)InValue;
+		if (FMath::Abs(Value) <= 1.0)
+		{
+			return InValue;
+		}
+		if (!FMath::IsFinite(Value))
+		{
+			return 0.0f;
+		}
+		double Phase = FMath::Fmod(Value, 4.0);
+		Phase = Phase < 0.0 ? Phase + 4.0 : Phase;
+		return (float)(Phase <= 1.0 ? Phase : (Phase <= 3.0 ? 2.0 - Phase : Phase - 4.0));
+	}
+
+	template<typename KernelType>
+	bool TestEdgeValues(FAutomationTestBase& InTest, const TCHAR* InName, float (*InExpected)(const float))
+	{
+		constexpr int32 NumValues = UE_ARRAY_COUNT(WrapReflectEdgeValues);
+		float Output[NumValues];
+
+		KernelType Kernel;
+		Kernel.ProcessAudioBuffer(WrapReflectEdgeValues, Output, NumValues);
+
+		bool bPassed = true;
+		for (int32 Index = 0; Index < NumValues; ++Index)
+		{
+			const float Expected = InExpected(WrapReflectEdgeValues[Index]);
+			if (Output[Index] != Expected)
+			{
+				InTest.AddError(FString::Printf(TEXT("%s(%.9g) returned %.9g, expected %.9g"), InName, WrapReflectEdgeValues[Index], Output[Index], Expected));
+				bPassed = false;
+			}
+		}
+		return bPassed;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAudioUtilsWrapEdgeValuesTest, "Audio.MetasoundsAudioMathUtils.Wrap.EdgeValues", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FAudioUtilsWrapEdgeValuesTest::RunTest(const FString& Parameters)
+{
+	return MetasoundsAudioMathUtilsTests::TestEdgeValues<DSPProcessing::FWrap>(*this, TEXT("Wrap"), &MetasoundsAudioMathUtilsTests::ExpectedWrap);
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAudioUtilsReflectEdgeValuesTest, "Audio.MetasoundsAudioMathUtils.Reflect.EdgeValues", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FAudioUtilsReflectEdgeValuesTest::RunTest(const FString& Parameters)
+{
+	return MetasoundsAudioMathUtilsTests::TestEdgeValues<DSPProcessing::FReflect>(*this, TEXT("Reflect"), &MetasoundsAudioMathUtilsTests::ExpectedReflect);
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
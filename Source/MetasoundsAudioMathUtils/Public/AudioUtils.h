@@ -8,33 +8,87 @@
 
 namespace DSPProcessing
 {
+// True if every sample equals the first, used to pick block-constant fast paths.
+bool IsBufferUniform(const float* InBuffer, const int32 InNumSamples);
 
-	//constexpr float sinc100[] =
-	//{0.0f, 0.0040394f, -0.0049956f, 0.00196776f, 0.00277942f, -0.00549833f, 0.00390557f, 0.000915266f, 
-	//	-0.0052291f, 0.0055295f, -0.00137314f, -0.00411038f, 0.00655771f, -0.00382482f, -0.00216395f, 
-	//	0.00674355f, -0.00611859f, 0.000480447f, 0.00590667f, -0.00790079f, 0.00358686f, 0.00395832f, 
-	//	-0.00881646f, 0.00682457f, 0.00091773f, -0.00853862f, 0.0097864f, -0.00308269f, -0.00678929f, 
-	//	0.0120079f, -0.00780443f, -0.00334221f, 0.0129758f, -0.0129218f, 0.00201072f, 0.0121007f, 
-	//	-0.0180509f, 0.00957585f, 0.00858315f, -0.022786f, 0.0201139f, 0.000918963f, -0.026739f, 0.0361677f, 
-	//	-0.0153096f, -0.0295782f, 0.0701196f, -0.0656615f, -0.0310615f, 0.441174f, 0.441174f, -0.0310615f, 
-	//	-0.0656615f, 0.0701196f, -0.0295782f, -0.0153096f, 0.0361677f, -0.026739f, 0.000918963f, 0.0201139f, 
-	//	-0.022786f, 0.00858315f, 0.00957585f, -0.0180509f, 0.0121007f, 0.00201072f, -0.0129218f, 0.0129758f, 
-	//	-0.00334221f, -0.00780443f, 0.0120079f, -0.00678929f, -0.00308269f, 0.0097864f, -0.00853862f, 
-	//	0.00091773f, 0.00682457f, -0.00881646f, 0.00395832f, 0.00358686f, -0.00790079f, 0.00590667f, 0.000480447 
-	//	-0.00611859f, 0.00674355 -0.00216395 -0.00382482, 0.00655771 -0.00411038 -0.00137314,  
-	//	0.0055295 -0.0052291, 0.000915266, 0.00390557f, -0.00549833f, 0.00277942f, 0.00196776f, -0.0049956f, 
-	//	0.0040394f, 0.0f };
+enum class EAccuracy : uint8
+{
+	// Hardware sqrt / divide, matches the scalar result
+	Precise,
+	// Estimate plus one Newton-Raphson step, ~1e-4 relative error worst case across platforms
+	Fast
+};
+
+enum class ESineMode : uint8
+{
+	Polynomial,
+	WavetableLinear,
+	WavetableCubic
+};
+
+enum class ESineTableSize : uint8
+{
+	Size512,
+	Size2048,
+	Size8192
+};
 
+// One cycle of sine, built once per process on first use and shared read-only by every FSine / FCos.
+class FSineWavetable
+{
+public:
+	static const FSineWavetable& Get(const ESineTableSize InTableSize);
+
+	// Sine(2PI(Phase)), Phase in cycles.
+	void ProcessLinear(const float* InPhase, float* OutBuffer, const float InPhaseOffset, const int32 InNumSamples) const;
+	void ProcessCubic(const float* InPhase, float* OutBuffer, const float InPhaseOffset, const int32 InNumSamples) const;
+
+private:
+	explicit FSineWavetable(const int32 InSize);
+
+	// Size + 4 points: one guard point before the cycle and three after, so cubic lookups never wrap.
+	TArray<float> Table;
+	int32 Size = 0;
+};
+
+// Divide by zero is always zero. Fast also treats subnormal divisors as zero and returns 0 for divisors past 2^126.
 class FAudioDivide
 {
 public:
-	void ProcessAudioBuffer(const float* InBuffer, float* OutBuffer, const float* InputGateToggle, const int32 InNumSamples);
+	void SetAccuracy(const EAccuracy InAccuracy);
+	void ProcessAudioBuffer(const float* InBuffer, float* OutBuffer, const float* InputAudioDivide, const int32 InNumSamples);
+private:
+	EAccuracy Accuracy = EAccuracy::Precise;
+};
+
+enum class EComparison : uint8
+{
+	Equals,
+	NotEquals,
+	LessThan,
+	GreaterThan,
+	LessThanOrEquals,
+	GreaterThanOrEquals
+};
+
+// Writes 1.0f where A <Comparison> B holds, 0.0f elsewhere. The template is instantiated for every EComparison.
+class METASOUNDSAUDIOMATHUTILS_API FCompare
+{
+public:
+	template<EComparison Comparison>
+	static void ProcessAudioBuffer(const float* InBufferA, const float* InBufferB, float* OutBuffer, const int32 InNumSamples);
+
+	static void ProcessAudioBuffer(const EComparison InComparison, const float* InBufferA, const float* InBufferB, float* OutBuffer, const int32 InNumSamples);
 };
 
 class FCos
 {
 public:
+	void SetMode(const ESineMode InMode, const ESineTableSize InTableSize);
 	void ProcessAudioBuffer(const float* InBuffer, float* OutBuffer, const int32 InNumSamples);
+private:
+	ESineMode Mode = ESineMode::Polynomial;
+	const FSineWavetable* Wavetable = nullptr;
 };
 
 class FGate
@@ -43,16 +97,22 @@ public:
 	void ProcessAudioBuffer(const float* InBuffer, float* OutBuffer, const float* InputGateToggle, const int32 InNumSamples);
 };
 
+// sign(x) * |x|^p. Uses exp2/log2 approximations (relative error ~1e-6) and exact multiply / sqrt
+// chains when the power is 0, 0.5, 1, 2, 3 or 4 for the whole block. Either way a result past the float range
+// is +/-Inf. Below FLT_MIN the approximation flushes to 0 where the exact chains may return a subnormal. Subnormal,
+// Inf and NaN operands are not special cased beyond NaN propagating.
 class FPow
 {
 public:
 	void ProcessAudioBuffer(const float* InBuffer, float* OutBuffer, const float* InputPowerOf, const int32 InNumSamples);
+	void ProcessConstantPower(const float* InBuffer, float* OutBuffer, const float InPowerOf, const int32 InNumSamples);
 };
 
 class FOnePoleIIR
 {
 public:
 	void ProcessAudioBuffer(const float* InBuffer, float* OutBuffer, const float* coefA, const float* coefB, const int32 InNumSamples);
+	void ProcessConstantCoefficients(const float* InBuffer, float* OutBuffer, const float InCoefA, const float InCoefB, const int32 InNumSamples);
 private:
 	float mPreviousSample = 0.0f;
 };
@@ -61,6 +121,7 @@ class FOnePoleFIR
 {
 public:
 	void ProcessAudioBuffer(const float* InBuffer, float* OutBuffer, const float* coefA, const float* coefB, const int32 InNumSamples);
+	void ProcessConstantCoefficients(const float* InBuffer, float* OutBuffer, const float InCoefA, const float InCoefB, const int32 InNumSamples);
 private:
 	float mPreviousInputSample = 0.0f;
 };
@@ -86,16 +147,41 @@ private:
 	float mPreviousPhasorValue = 0.0f;
 };
 
+// Out = A <Comparison> B ? X : Y in one pass. The template is instantiated for every EComparison.
+class METASOUNDSAUDIOMATHUTILS_API FSelect
+{
+public:
+	template<EComparison Comparison>
+	static void ProcessAudioBuffer(const float* InBufferA, const float* InBufferB, const float* InBufferX, const float* InBufferY, float* OutBuffer, const int32 InNumSamples);
+
+	static void ProcessAudioBuffer(const EComparison InComparison, const float* InBufferA, const float* InBufferB, const float* InBufferX, const float* InBufferY, float* OutBuffer, const int32 InNumSamples);
+};
+
 class FSine
 {
 public:
+	void SetMode(const ESineMode InMode, const ESineTableSize InTableSize);
 	void ProcessAudioBuffer(const float* InBuffer, float* OutBuffer, const int32 InNumSamples);
+private:
+	ESineMode Mode = ESineMode::Polynomial;
+	const FSineWavetable* Wavetable = nullptr;
+};
+
+// Writes Sine(2PI(Input)) and Cos(2PI(Input)) in one pass, sharing the phase reduction.
+class FSinCos
+{
+public:
+	void ProcessAudioBuffer(const float* InBuffer, float* OutSinBuffer, float* OutCosBuffer, const int32 InNumSamples);
 };
 
+// sign(x) * sqrt(|x|)
 class FSqrt
 {
 public:
+	void SetAccuracy(const EAccuracy InAccuracy);
 	void ProcessAudioBuffer(const float* InBuffer, float* OutBuffer, const int32 InNumSamples);
+private:
+	EAccuracy Accuracy = EAccuracy::Precise;
 };
 
 class FWrap
@@ -103,4 +189,44 @@ class FWrap
 public:
 	void ProcessAudioBuffer(const float* InBuffer, float* OutBuffer, const int32 InNumSamples);
 };
+
+// First order antiderivative anti-aliasing (ADAA) versions of FWrap, FReflect and FPow.
+// Out = (F(x[n]) - F(x[n-1])) / (x[n] - x[n-1]) with F the kernel's closed form antiderivative, i.e. the kernel
+// averaged over the step between samples. Falls back to the kernel at the midpoint where both samples are on one
+// linear piece (where it is the same value) or the step is too small for the difference to be trusted.
+// About half a sample of delay and a gentle top octave roll off, as with any first order ADAA.
+// Reset with the first sample of the next block, its zero step then falls back to the kernel's own value rather
+// than averaging from a stale or zero previous input, which clicks when ADAA is switched back on mid signal.
+class FWrapADAA
+{
+public:
+	void Reset(const float InFirstSample = 0.0f);
+	void ProcessAudioBuffer(const float* InBuffer, float* OutBuffer, const int32 InNumSamples);
+private:
+	float mPreviousInput = 0.0f;
+};
+
+class FReflectADAA
+{
+public:
+	void Reset(const float InFirstSample = 0.0f);
+	void ProcessAudioBuffer(const float* InBuffer, float* OutBuffer, const int32 InNumSamples);
+private:
+	float mPreviousInput = 0.0f;
+};
+
+// Powers at or below -0.5 have no usable antiderivative near 0 and always take the midpoint.
+class FPowADAA
+{
+public:
+	void Reset(const float InFirstSample = 0.0f);
+	void ProcessAudioBuffer(const float* InBuffer, float* OutBuffer, const float* InputPowerOf, const int32 InNumSamples);
+private:
+	void ProcessConstantPower(const float* InBuffer, float* OutBuffer, const float InPowerOf, const int32 InNumSamples);
+
+	float mPreviousInput = 0.0f;
+	// (p + 1) * F(mPreviousInput) with p = mPreviousPower
+	float mPreviousAntiderivative = 0.0f;
+	float mPreviousPower = 1.0f;
+};
 } // namespace DSPProcessing
@@ -8,20 +8,93 @@
 namespace DSPProcessing
 {
 
+// How often the cutoff and Q inputs are turned into filter coefficients, g and k are ramped in between
+enum class ESVFUpdateRate : uint8
+{
+	EverySample,
+	Every8,
+	Every16,
+	Every32
+};
+
+// tan(PI * Cutoff / SampleRate) by linear interpolation over normalized cutoff, one table shared process-wide.
+// Indexing by Cutoff / SampleRate keeps the one table valid at every sample rate.
+// Normalized cutoff is clamped to [0, MaxNormalizedCutoff], max relative error ~4e-5 at the top of the range.
+class METASOUNDSAUDIOMATHUTILS_API FSVFTanTable
+{
+public:
+	static constexpr int32 Size = 4096;
+	static constexpr float MaxNormalizedCutoff = 0.49f;
+
+	static const FSVFTanTable& Get();
+
+	float Lookup(const float InNormalizedCutoff) const;
+	// OutG[i] = tan(PI * InCutoff[i] * InInvSampleRate)
+	void ProcessBuffer(const float* InCutoff, const float InInvSampleRate, float* OutG, const int32 InNumSamples) const;
+
+private:
+	FSVFTanTable();
+
+	// Size + 2 points, the last is a guard so the top segment can be interpolated without a branch
+	TArray<float> Table;
+};
+
 class METASOUNDSAUDIOMATHUTILS_API CytomicSVF
 {
 public:
 	CytomicSVF();
+	// Cutoffs are in Hz, so this must match the rate the filter runs at
+	void SetSampleRate(const float InSampleRate);
 	void SetLPF();
 	void setHPF();
 	void setBP();
+	void SetUpdateRate(const ESVFUpdateRate InUpdateRate);
+	// Cutoff to g through FSVFTanTable instead of Audio::FastTan
+	void SetUseTanTable(const bool bInUseTanTable);
+	// Sizes the per-sample coefficient scratch, call with the block size up front so processing never allocates
+	void SetMaxBlockSize(const int32 InMaxNumSamples);
 	void ProcessAudioBuffer(const float* InBuffer, float* OutBuffer, const float* CutoffFreq, const float* QAmount, const int32 InNumSamples);
+	// Low, band, high, notch and peak from one state update, ignores the mode set above. Any output may be null.
+	void ProcessAudioBufferMultimode(const float* InBuffer, const float* CutoffFreq, const float* QAmount, float* OutLow, float* OutBand, float* OutHigh, float* OutNotch, float* OutPeak, const int32 InNumSamples);
 
 private:
+	void SetCoefficients(const float InG, const float InK);
+	float CutoffToG(const float InCutoff) const;
+	// True when Cutoff and Q are static and the coefficient members hold for the block, otherwise fills the scratch arrays
+	bool PrepareCoefficients(const float* CutoffFreq, const float* QAmount, const int32 InNumSamples);
+
 	float g = 0.0f, k = 0.0f, a1 = 0.0f, a2 = 0.0f, a3 = 0.0f;  // filter coefficients
 	float m0 = 0.0f, m1 = 0.0f, m2 = 0.0f;
 	float ic1eq = 0.0f, ic2eq = 0.0f;      // internal state
-	const float fs = 48000.0f;
+	float fs = 48000.0f;
+	int32 UpdateInterval = 1;
+	const FSVFTanTable* TanTable = nullptr;
+	TArray<float> ScratchA1, ScratchA2, ScratchA3, ScratchK;	// per-sample coefficients for modulated blocks
+	bool bHasCoefficients = false;	// false until g and k have been computed once, so the first ramp doesn't start from 0
+};
+
+// Structure of arrays CytomicSVF for banks of filters on one input, 4 filters advance per vector op.
+// Coefficients are per block, set each filter before processing.
+class METASOUNDSAUDIOMATHUTILS_API FCytomicSVFBank
+{
+public:
+	void SetNumFilters(const int32 InNumFilters);
+	void SetSampleRate(const float InSampleRate);
+	int32 GetNumFilters() const { return NumFilters; }
+	void SetLPF();
+	void SetHPF();
+	void SetBP();
+	// uses the current mode, so set the mode first
+	void SetFilter(const int32 InIndex, const float InCutoff, const float InQ, const float InGain);
+	// writes the gain weighted sum of every filter
+	void ProcessAudioBuffer(const float* InBuffer, float* OutBuffer, const int32 InNumSamples);
+
+private:
+	int32 NumFilters = 0;
+	// lane arrays padded to a multiple of 4, padding lanes have zero gain
+	TArray<float> IC1, IC2, A1, A2, A3, InputGain, BandGain, LowGain;
+	float m0 = 0.0f, m1 = 0.0f, m2 = 1.0f;
+	float fs = 48000.0f;
 };
 
 } //namespace DSPProcessing
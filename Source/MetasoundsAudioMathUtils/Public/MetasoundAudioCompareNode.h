@@ -28,6 +28,19 @@ namespace Metasound
 	DECLARE_METASOUND_ENUM(EAudioComparisonType, EAudioComparisonType::Equals, METASOUNDSAUDIOMATHUTILS_API,
 		FEnumAudioCompareType, FEnumAudioCompareTypeInfo, FEnumAudioCompareTypeReadRef, FEnumAudioCompareTypeWriteRef);
 
+	// For the Compare and Select nodes. The kernels' enum is declared separately, the asserts keep the two in step.
+	static_assert((uint8)EAudioComparisonType::Equals == (uint8)DSPProcessing::EComparison::Equals, "EAudioComparisonType must match DSPProcessing::EComparison");
+	static_assert((uint8)EAudioComparisonType::NotEquals == (uint8)DSPProcessing::EComparison::NotEquals, "EAudioComparisonType must match DSPProcessing::EComparison");
+	static_assert((uint8)EAudioComparisonType::LessThan == (uint8)DSPProcessing::EComparison::LessThan, "EAudioComparisonType must match DSPProcessing::EComparison");
+	static_assert((uint8)EAudioComparisonType::GreaterThan == (uint8)DSPProcessing::EComparison::GreaterThan, "EAudioComparisonType must match DSPProcessing::EComparison");
+	static_assert((uint8)EAudioComparisonType::LessThanOrEquals == (uint8)DSPProcessing::EComparison::LessThanOrEquals, "EAudioComparisonType must match DSPProcessing::EComparison");
+	static_assert((uint8)EAudioComparisonType::GreaterThanOrEquals == (uint8)DSPProcessing::EComparison::GreaterThanOrEquals, "EAudioComparisonType must match DSPProcessing::EComparison");
+
+	inline DSPProcessing::EComparison ToDSPComparison(const EAudioComparisonType InComparison)
+	{
+		return (DSPProcessing::EComparison)InComparison;
+	}
+
 	//------------------------------------------------------------------------------------
 	// FCompareOperator
 	//------------------------------------------------------------------------------------
@@ -4,6 +4,7 @@
 #pragma once
 
 #include "AudioUtils.h"
+#include "MetasoundAudioMathUtilsEnums.h"
 #include "MetasoundEnumRegistrationMacro.h"
 #include "MetasoundParamHelper.h"
 
@@ -19,7 +20,7 @@ namespace Metasound
 		static const FVertexInterface& GetVertexInterface();
 		static TUniquePtr<IOperator> CreateOperator(const FBuildOperatorParams& InParams, FBuildResults& OutErrors);
 
-		FAudioDivideOperator(const FOperatorSettings& InSettings, const FAudioBufferReadRef& InAudioInput, const FAudioBufferReadRef& InAudioDivide);
+		FAudioDivideOperator(const FOperatorSettings& InSettings, const FAudioBufferReadRef& InAudioInput, const FAudioBufferReadRef& InAudioDivide, const FEnumAudioAccuracyReadRef& InAccuracy);
 
 		virtual void BindInputs(FInputVertexInterfaceData& InOutVertexData) override;
 		virtual void BindOutputs(FOutputVertexInterfaceData& InOutVertexData) override;
@@ -32,6 +33,8 @@ namespace Metasound
 
 		FAudioBufferReadRef	 mInAudioDivide;
 
+		FEnumAudioAccuracyReadRef mAccuracy;
+
 		DSPProcessing::FAudioDivide AudioDivideDSPProcessor;
 
 	};
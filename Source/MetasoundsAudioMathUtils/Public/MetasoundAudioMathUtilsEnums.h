@@ -0,0 +1,51 @@
+// Copyright Christopher Wratt 2024.
+// All code under MIT license: see https://mit-license.org/
+
+#pragma once
+
+#include "MetasoundEnumRegistrationMacro.h"
+
+namespace Metasound
+{
+	// Accuracy tier for kernels with an estimate based fast path
+	enum class EAudioAccuracy
+	{
+		Precise,
+		Fast
+	};
+
+	DECLARE_METASOUND_ENUM(EAudioAccuracy, EAudioAccuracy::Precise, METASOUNDSAUDIOMATHUTILS_API,
+		FEnumAudioAccuracy, FEnumAudioAccuracyInfo, FEnumAudioAccuracyReadRef, FEnumAudioAccuracyWriteRef);
+
+	// Shared by the nonlinear nodes that can run their kernel oversampled
+	enum class EAudioOversample
+	{
+		None,
+		X2,
+		X4
+	};
+
+	DECLARE_METASOUND_ENUM(EAudioOversample, EAudioOversample::None, METASOUNDSAUDIOMATHUTILS_API,
+		FEnumAudioOversample, FEnumAudioOversampleInfo, FEnumAudioOversampleReadRef, FEnumAudioOversampleWriteRef);
+
+	// Shared by the Sine and Cos nodes
+	enum class EAudioSineMode
+	{
+		Polynomial,
+		WavetableLinear,
+		WavetableCubic
+	};
+
+	DECLARE_METASOUND_ENUM(EAudioSineMode, EAudioSineMode::Polynomial, METASOUNDSAUDIOMATHUTILS_API,
+		FEnumAudioSineMode, FEnumAudioSineModeInfo, FEnumAudioSineModeReadRef, FEnumAudioSineModeWriteRef);
+
+	enum class EAudioSineTableSize
+	{
+		Size512,
+		Size2048,
+		Size8192
+	};
+
+	DECLARE_METASOUND_ENUM(EAudioSineTableSize, EAudioSineTableSize::Size2048, METASOUNDSAUDIOMATHUTILS_API,
+		FEnumAudioSineTableSize, FEnumAudioSineTableSizeInfo, FEnumAudioSineTableSizeReadRef, FEnumAudioSineTableSizeWriteRef);
+}
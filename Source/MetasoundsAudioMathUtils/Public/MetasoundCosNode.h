@@ -4,6 +4,7 @@
 #pragma once
 
 #include "AudioUtils.h"
+#include "MetasoundAudioMathUtilsEnums.h"
 #include "MetasoundEnumRegistrationMacro.h"
 #include "MetasoundParamHelper.h"
 
@@ -19,7 +20,7 @@ namespace Metasound
 		static const FVertexInterface& GetVertexInterface();
 		static TUniquePtr<IOperator> CreateOperator(const FBuildOperatorParams& InParams, FBuildResults& OutErrors);
 
-		FCosOperator(const FOperatorSettings& InSettings, const FAudioBufferReadRef& InAudioInput);
+		FCosOperator(const FOperatorSettings& InSettings, const FAudioBufferReadRef& InAudioInput, const FEnumAudioSineModeReadRef& InMode, const FEnumAudioSineTableSizeReadRef& InTableSize);
 
 		virtual void BindInputs(FInputVertexInterfaceData& InOutVertexData) override;
 		virtual void BindOutputs(FOutputVertexInterfaceData& InOutVertexData) override;
@@ -30,7 +31,12 @@ namespace Metasound
 		FAudioBufferReadRef	 AudioInput;
 		FAudioBufferWriteRef AudioOutput;
 
+		FEnumAudioSineModeReadRef mMode;
+		FEnumAudioSineTableSizeReadRef mTableSize;
+
 		DSPProcessing::FCos CosDSPProcessor;
+		EAudioSineMode mCurrentMode;
+		EAudioSineTableSize mCurrentTableSize;
 
 	};
 
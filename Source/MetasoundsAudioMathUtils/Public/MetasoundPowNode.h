@@ -4,6 +4,8 @@
 #pragma once
 
 #include "AudioUtils.h"
+#include "Oversampler.h"
+#include "MetasoundAudioMathUtilsEnums.h"
 #include "MetasoundEnumRegistrationMacro.h"
 #include "MetasoundParamHelper.h"
 
@@ -19,7 +21,7 @@ namespace Metasound
 		static const FVertexInterface& GetVertexInterface();
 		static TUniquePtr<IOperator> CreateOperator(const FBuildOperatorParams& InParams, FBuildResults& OutErrors);
 
-		FPowOperator(const FOperatorSettings& InSettings, const FAudioBufferReadRef& InAudioInput, const FAudioBufferReadRef& InPowerOf);
+		FPowOperator(const FOperatorSettings& InSettings, const FAudioBufferReadRef& InAudioInput, const FAudioBufferReadRef& InPowerOf, const FEnumAudioOversampleReadRef& InOversample, const FBoolReadRef& InUseADAA);
 
 		virtual void BindInputs(FInputVertexInterfaceData& InOutVertexData) override;
 		virtual void BindOutputs(FOutputVertexInterfaceData& InOutVertexData) override;
@@ -32,7 +34,10 @@ namespace Metasound
 
 		FAudioBufferReadRef	 mInPowerOf;
 
-		DSPProcessing::FPow PowDSPProcessor;
+		FEnumAudioOversampleReadRef mOversample;
+		FBoolReadRef mUseADAA;
+
+		DSPProcessing::TAntialiased<DSPProcessing::FPow, DSPProcessing::FPowADAA> PowProcessor;
 
 	};
 
@@ -4,6 +4,8 @@
 #pragma once
 
 #include "AudioUtils.h"
+#include "Oversampler.h"
+#include "MetasoundAudioMathUtilsEnums.h"
 #include "MetasoundEnumRegistrationMacro.h"
 #include "MetasoundParamHelper.h"
 
@@ -19,7 +21,7 @@ namespace Metasound
 		static const FVertexInterface& GetVertexInterface();
 		static TUniquePtr<IOperator> CreateOperator(const FBuildOperatorParams& InParams, FBuildResults& OutErrors);
 
-		FReflectOperator(const FOperatorSettings& InSettings, const FAudioBufferReadRef& InAudioInput);
+		FReflectOperator(const FOperatorSettings& InSettings, const FAudioBufferReadRef& InAudioInput, const FEnumAudioOversampleReadRef& InOversample, const FBoolReadRef& InUseADAA);
 
 		virtual void BindInputs(FInputVertexInterfaceData& InOutVertexData) override;
 		virtual void BindOutputs(FOutputVertexInterfaceData& InOutVertexData) override;
@@ -30,7 +32,10 @@ namespace Metasound
 		FAudioBufferReadRef	 AudioInput;
 		FAudioBufferWriteRef AudioOutput;
 
-		DSPProcessing::FReflect ReflectDSPProcessor;
+		FEnumAudioOversampleReadRef mOversample;
+		FBoolReadRef mUseADAA;
+
+		DSPProcessing::TAntialiased<DSPProcessing::FReflect, DSPProcessing::FReflectADAA> ReflectProcessor;
 
 	};
 
@@ -0,0 +1,60 @@
+// Copyright Christopher Wratt 2024.
+// All code under MIT license: see https://mit-license.org/
+
+#pragma once
+
+#include "AudioUtils.h"
+#include "MetasoundAudioCompareNode.h"
+#include "MetasoundEnumRegistrationMacro.h"
+#include "MetasoundParamHelper.h"
+
+namespace Metasound
+{
+	//------------------------------------------------------------------------------------
+	// FSelectOperator
+	//------------------------------------------------------------------------------------
+	class FSelectOperator : public TExecutableOperator<FSelectOperator>
+	{
+	public:
+		static const FNodeClassMetadata& GetNodeInfo();
+		static const FVertexInterface& GetVertexInterface();
+		static TUniquePtr<IOperator> CreateOperator(const FBuildOperatorParams& InParams, FBuildResults& OutErrors);
+
+		FSelectOperator(const FOperatorSettings& InSettings, const FAudioBufferReadRef& InA, const FAudioBufferReadRef& InB, const FAudioBufferReadRef& InX, const FAudioBufferReadRef& InY, const FEnumAudioCompareTypeReadRef& InComparisonTypeReadRef);
+
+		virtual void BindInputs(FInputVertexInterfaceData& InOutVertexData) override;
+		virtual void BindOutputs(FOutputVertexInterfaceData& InOutVertexData) override;
+
+		void Execute();
+
+	private:
+		FAudioBufferReadRef	 mInA;
+		FAudioBufferReadRef	 mInB;
+		FAudioBufferReadRef	 mInX;
+		FAudioBufferReadRef	 mInY;
+		FEnumAudioCompareTypeReadRef mComparisonType;
+		FAudioBufferWriteRef AudioOutput;
+	};
+
+	//------------------------------------------------------------------------------------
+	// FSelectNode
+	//------------------------------------------------------------------------------------
+	class METASOUNDSAUDIOMATHUTILS_API FSelectNode : public FNodeFacade
+	{
+	public:
+		// Constructor used by the Metasound Frontend.
+		FSelectNode(const FNodeInitData& InitData)
+			: FNodeFacade(InitData.InstanceName, InitData.InstanceID, TFacadeOperatorClass<FSelectOperator>())
+		{
+
+		}
+
+		FSelectNode(FNodeData InNodeData, TSharedRef<const FNodeClassMetadata> InClassMetadata)
+			: FNodeFacade(InNodeData, InClassMetadata, TFacadeOperatorClass<FSelectOperator>())
+		{
+
+		}
+
+		static FNodeClassMetadata CreateNodeClassMetadata();
+	};
+}
@@ -0,0 +1,59 @@
+// Copyright Christopher Wratt 2024.
+// All code under MIT license: see https://mit-license.org/
+
+#pragma once
+
+#include "AudioUtils.h"
+#include "MetasoundEnumRegistrationMacro.h"
+#include "MetasoundParamHelper.h"
+
+namespace Metasound
+{
+	//------------------------------------------------------------------------------------
+	// FSinCosOperator
+	//------------------------------------------------------------------------------------
+	class FSinCosOperator : public TExecutableOperator<FSinCosOperator>
+	{
+	public:
+		static const FNodeClassMetadata& GetNodeInfo();
+		static const FVertexInterface& GetVertexInterface();
+		static TUniquePtr<IOperator> CreateOperator(const FBuildOperatorParams& InParams, FBuildResults& OutErrors);
+
+		FSinCosOperator(const FOperatorSettings& InSettings, const FAudioBufferReadRef& InAudioInput);
+
+		virtual void BindInputs(FInputVertexInterfaceData& InOutVertexData) override;
+		virtual void BindOutputs(FOutputVertexInterfaceData& InOutVertexData) override;
+
+		void Execute();
+
+	private:
+		FAudioBufferReadRef	 AudioInput;
+		FAudioBufferWriteRef SinOutput;
+		FAudioBufferWriteRef CosOutput;
+
+		DSPProcessing::FSinCos SinCosDSPProcessor;
+
+	};
+
+	//------------------------------------------------------------------------------------
+	// FSinCosNode
+	//------------------------------------------------------------------------------------
+	class METASOUNDSAUDIOMATHUTILS_API FSinCosNode : public FNodeFacade
+	{
+	public:
+		// Constructor used by the Metasound Frontend.
+		FSinCosNode(const FNodeInitData& InitData)
+			: FNodeFacade(InitData.InstanceName, InitData.InstanceID, TFacadeOperatorClass<FSinCosOperator>())
+		{
+
+		}
+
+		FSinCosNode(FNodeData InNodeData, TSharedRef<const FNodeClassMetadata> InClassMetadata)
+			: FNodeFacade(InNodeData, InClassMetadata, TFacadeOperatorClass<FSinCosOperator>())
+		{
+
+		}
+
+		static FNodeClassMetadata CreateNodeClassMetadata();
+	};
+}
@@ -4,8 +4,11 @@
 #pragma once
 
 #include "AudioUtils.h"
+#include "MetasoundAudioMathUtilsEnums.h"
 #include "MetasoundEnumRegistrationMacro.h"
 #include "MetasoundParamHelper.h"
+#include "MetasoundFacade.h"
+#include "MetasoundVertex.h"
 
 namespace Metasound
 {
@@ -19,7 +22,7 @@ namespace Metasound
 		static const FVertexInterface& GetVertexInterface();
 		static TUniquePtr<IOperator> CreateOperator(const FBuildOperatorParams& InParams, FBuildResults& OutErrors);
 
-		FSineOperator(const FOperatorSettings& InSettings, const FAudioBufferReadRef& InAudioInput);
+		FSineOperator(const FOperatorSettings& InSettings, const FAudioBufferReadRef& InAudioInput, const FEnumAudioSineModeReadRef& InMode, const FEnumAudioSineTableSizeReadRef& InTableSize);
 
 		virtual void BindInputs(FInputVertexInterfaceData& InOutVertexData) override;
 		virtual void BindOutputs(FOutputVertexInterfaceData& InOutVertexData) override;
@@ -30,7 +33,12 @@ namespace Metasound
 		FAudioBufferReadRef	 AudioInput;
 		FAudioBufferWriteRef AudioOutput;
 
+		FEnumAudioSineModeReadRef mMode;
+		FEnumAudioSineTableSizeReadRef mTableSize;
+
 		DSPProcessing::FSine SineDSPProcessor;
+		EAudioSineMode mCurrentMode;
+		EAudioSineTableSize mCurrentTableSize;
 
 	};
 
@@ -4,8 +4,12 @@
 #pragma once
 
 #include "AudioUtils.h"
+#include "Oversampler.h"
+#include "MetasoundAudioMathUtilsEnums.h"
 #include "MetasoundEnumRegistrationMacro.h"
 #include "MetasoundParamHelper.h"
+#include "MetasoundFacade.h"
+#include "MetasoundVertex.h"
 
 namespace Metasound
 {
@@ -19,7 +23,7 @@ namespace Metasound
 		static const FVertexInterface& GetVertexInterface();
 		static TUniquePtr<IOperator> CreateOperator(const FBuildOperatorParams& InParams, FBuildResults& OutErrors);
 
-		FSqrtOperator(const FOperatorSettings& InSettings, const FAudioBufferReadRef& InAudioInput);
+		FSqrtOperator(const FOperatorSettings& InSettings, const FAudioBufferReadRef& InAudioInput, const FEnumAudioAccuracyReadRef& InAccuracy, const FEnumAudioOversampleReadRef& InOversample);
 
 		virtual void BindInputs(FInputVertexInterfaceData& InOutVertexData) override;
 		virtual void BindOutputs(FOutputVertexInterfaceData& InOutVertexData) override;
@@ -30,7 +34,11 @@ namespace Metasound
 		FAudioBufferReadRef	 AudioInput;
 		FAudioBufferWriteRef AudioOutput;
 
-		DSPProcessing::FSqrt SqrtDSPProcessor;
+		FEnumAudioAccuracyReadRef mAccuracy;
+
+		FEnumAudioOversampleReadRef mOversample;
+
+		DSPProcessing::TAntialiased<DSPProcessing::FSqrt> SqrtProcessor;
 
 	};
 
@@ -0,0 +1,65 @@
+// Copyright Christopher Wratt 2024.
+// All code under MIT license: see https://mit-license.org/
+
+#pragma once
+
+#include "CytomicSVF.h"
+#include "MetasoundVCFNode.h"
+#include "MetasoundEnumRegistrationMacro.h"
+#include "MetasoundParamHelper.h"
+#include "MetasoundFacade.h"
+#include "MetasoundVertex.h"
+
+namespace Metasound
+{
+	//------------------------------------------------------------------------------------
+	// FVCFBankOperator
+	//------------------------------------------------------------------------------------
+	class FVCFBankOperator : public TExecutableOperator<FVCFBankOperator>
+	{
+	public:
+		static const FNodeClassMetadata& GetNodeInfo();
+		static const FVertexInterface& GetVertexInterface();
+		static TUniquePtr<IOperator> CreateOperator(const FBuildOperatorParams& InParams, FBuildResults& OutErrors);
+
+		FVCFBankOperator(const FOperatorSettings& InSettings, const FAudioBufferReadRef& InAudioInput, const TDataReadReference<TArray<float>>& InCutoffs, const TDataReadReference<TArray<float>>& InQs, const TDataReadReference<TArray<float>>& InGains, const FEnumVCFFilterTypeReadRef& InFilterType);
+
+		virtual void BindInputs(FInputVertexInterfaceData& InOutVertexData) override;
+		virtual void BindOutputs(FOutputVertexInterfaceData& InOutVertexData) override;
+
+		void Execute();
+
+	private:
+		FAudioBufferReadRef	 AudioInput;
+		FAudioBufferWriteRef AudioOutput;
+
+		TDataReadReference<TArray<float>> mCutoffs;
+		TDataReadReference<TArray<float>> mQs;
+		TDataReadReference<TArray<float>> mGains;
+		FEnumVCFFilterTypeReadRef mFilterType;
+
+		DSPProcessing::FCytomicSVFBank mCytomicSVFBank;
+	};
+
+	//------------------------------------------------------------------------------------
+	// FVCFBankNode
+	//------------------------------------------------------------------------------------
+	class METASOUNDSAUDIOMATHUTILS_API FVCFBankNode : public FNodeFacade
+	{
+	public:
+		// Constructor used by the Metasound Frontend.
+		FVCFBankNode(const FNodeInitData& InitData)
+			: FNodeFacade(InitData.InstanceName, InitData.InstanceID, TFacadeOperatorClass<FVCFBankOperator>())
+		{
+
+		}
+
+		FVCFBankNode(FNodeData InNodeData, TSharedRef<const FNodeClassMetadata> InClassMetadata)
+			: FNodeFacade(InNodeData, InClassMetadata, TFacadeOperatorClass<FVCFBankOperator>())
+		{
+
+		}
+
+		static FNodeClassMetadata CreateNodeClassMetadata();
+	};
+}
@@ -0,0 +1,69 @@
+// Copyright Christopher Wratt 2024.
+// All code under MIT license: see https://mit-license.org/
+
+#pragma once
+
+#include "CytomicSVF.h"
+#include "MetasoundVCFNode.h"
+#include "MetasoundEnumRegistrationMacro.h"
+#include "MetasoundParamHelper.h"
+#include "MetasoundFacade.h"
+#include "MetasoundVertex.h"
+
+namespace Metasound
+{
+	//------------------------------------------------------------------------------------
+	// FVCFMultimodeOperator
+	//------------------------------------------------------------------------------------
+	class FVCFMultimodeOperator : public TExecutableOperator<FVCFMultimodeOperator>
+	{
+	public:
+		static const FNodeClassMetadata& GetNodeInfo();
+		static const FVertexInterface& GetVertexInterface();
+		static TUniquePtr<IOperator> CreateOperator(const FBuildOperatorParams& InParams, FBuildResults& OutErrors);
+
+		FVCFMultimodeOperator(const FOperatorSettings& InSettings, const FAudioBufferReadRef& InAudioInput, const FAudioBufferReadRef& InVCFCutoff, const FAudioBufferReadRef& InVCFQ, const FEnumVCFUpdateRateReadRef& InUpdateRate, const FBoolReadRef& InUseTanTable);
+
+		virtual void BindInputs(FInputVertexInterfaceData& InOutVertexData) override;
+		virtual void BindOutputs(FOutputVertexInterfaceData& InOutVertexData) override;
+
+		void Execute();
+
+	private:
+		FAudioBufferReadRef	 AudioInput;
+		FAudioBufferWriteRef LowPassOutput;
+		FAudioBufferWriteRef BandPassOutput;
+		FAudioBufferWriteRef HighPassOutput;
+		FAudioBufferWriteRef NotchOutput;
+		FAudioBufferWriteRef PeakOutput;
+
+		FAudioBufferReadRef	 mInVCFCutoff;
+		FAudioBufferReadRef	 mInVCFQ;
+		FEnumVCFUpdateRateReadRef mUpdateRate;
+		FBoolReadRef mUseTanTable;
+
+		DSPProcessing::CytomicSVF mCytomicSVF;
+	};
+
+	//------------------------------------------------------------------------------------
+	// FVCFMultimodeNode
+	//------------------------------------------------------------------------------------
+	class METASOUNDSAUDIOMATHUTILS_API FVCFMultimodeNode : public FNodeFacade
+	{
+	public:
+		// Constructor used by the Metasound Frontend.
+		FVCFMultimodeNode(const FNodeInitData& InitData)
+			: FNodeFacade(InitData.InstanceName, InitData.InstanceID, TFacadeOperatorClass<FVCFMultimodeOperator>())
+		{
+
+		}
+
+		FVCFMultimodeNode(FNodeData InNodeData, TSharedRef<const FNodeClassMetadata> InClassMetadata)
+			: FNodeFacade(InNodeData, InClassMetadata, TFacadeOperatorClass<FVCFMultimodeOperator>())
+		{
+
+		}
+
+		static FNodeClassMetadata CreateNodeClassMetadata();
+	};
+}
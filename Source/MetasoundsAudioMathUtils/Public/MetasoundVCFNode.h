@@ -21,6 +21,28 @@ namespace Metasound
 	DECLARE_METASOUND_ENUM(EVCFFilterType, EVCFFilterType::LowPass, METASOUNDSAUDIOMATHUTILS_API,
 		FEnumVCFFilterType, FEnumVCFFilterTypeInfo, FEnumVCFFilterTypeReadRef, FEnumVCFFilterTypeWriteRef);
 
+	enum class EVCFUpdateRate
+	{
+		EverySample,
+		Every8,
+		Every16,
+		Every32
+	};
+
+	DECLARE_METASOUND_ENUM(EVCFUpdateRate, EVCFUpdateRate::EverySample, METASOUNDSAUDIOMATHUTILS_API,
+		FEnumVCFUpdateRate, FEnumVCFUpdateRateInfo, FEnumVCFUpdateRateReadRef, FEnumVCFUpdateRateWriteRef);
+
+	// The filter's enum is declared separately, the asserts keep the two in step
+	static_assert((uint8)EVCFUpdateRate::EverySample == (uint8)DSPProcessing::ESVFUpdateRate::EverySample, "EVCFUpdateRate must match DSPProcessing::ESVFUpdateRate");
+	static_assert((uint8)EVCFUpdateRate::Every8 == (uint8)DSPProcessing::ESVFUpdateRate::Every8, "EVCFUpdateRate must match DSPProcessing::ESVFUpdateRate");
+	static_assert((uint8)EVCFUpdateRate::Every16 == (uint8)DSPProcessing::ESVFUpdateRate::Every16, "EVCFUpdateRate must match DSPProcessing::ESVFUpdateRate");
+	static_assert((uint8)EVCFUpdateRate::Every32 == (uint8)DSPProcessing::ESVFUpdateRate::Every32, "EVCFUpdateRate must match DSPProcessing::ESVFUpdateRate");
+
+	inline DSPProcessing::ESVFUpdateRate ToDSPUpdateRate(const EVCFUpdateRate InUpdateRate)
+	{
+		return (DSPProcessing::ESVFUpdateRate)InUpdateRate;
+	}
+
 	//------------------------------------------------------------------------------------
 	// FVCFOperator
 	//------------------------------------------------------------------------------------
@@ -31,7 +53,7 @@ namespace Metasound
 		static const FVertexInterface& GetVertexInterface();
 		static TUniquePtr<IOperator> CreateOperator(const FBuildOperatorParams& InParams, FBuildResults& OutErrors);
 
-		FVCFOperator(const FOperatorSettings& InSettings, const FAudioBufferReadRef& InAudioInput, const FAudioBufferReadRef& InVCFCutoff, const FAudioBufferReadRef& InVCFQ, FEnumVCFFilterTypeReadRef& filterType);
+		FVCFOperator(const FOperatorSettings& InSettings, const FAudioBufferReadRef& InAudioInput, const FAudioBufferReadRef& InVCFCutoff, const FAudioBufferReadRef& InVCFQ, FEnumVCFFilterTypeReadRef& filterType, const FEnumVCFUpdateRateReadRef& InUpdateRate, const FBoolReadRef& InUseTanTable);
 
 		virtual void BindInputs(FInputVertexInterfaceData& InOutVertexData) override;
 		virtual void BindOutputs(FOutputVertexInterfaceData& InOutVertexData) override;
@@ -50,6 +72,8 @@ namespace Metasound
 		DSPProcessing::CytomicSVF mCytomicSVF;
 
 		FEnumVCFFilterTypeReadRef mFilterType;
+		FEnumVCFUpdateRateReadRef mUpdateRate;
+		FBoolReadRef mUseTanTable;
 
 	};
 
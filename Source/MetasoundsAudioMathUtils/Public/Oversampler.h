@@ -0,0 +1,365 @@
+// Copyright Christopher Wratt 2024.
+// All code under MIT license: see https://mit-license.org/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include <type_traits>
+
+namespace DSPProcessing
+{
+
+enum class EOversample : uint8
+{
+	None,
+	X2,
+	X4
+};
+
+// 2x polyphase halfband resampler. A halfband's even taps are zero apart from the 0.5 centre, so upsampling
+// is a delay on the even outputs and one NumTaps FIR on the odd outputs, and downsampling is the mirror of that.
+// Zero stuffed samples are never formed. Each direction delays by NumTaps / 2 samples at the lower rate.
+template<int32 NumTaps>
+class THalfbandResampler
+{
+	static_assert(NumTaps % 4 == 0, "Taps are processed 4 outputs at a time");
+
+public:
+	static constexpr int32 Latency = NumTaps / 2;
+
+	// Odd branch taps, Kaiser windowed sinc with unity DC gain, built once per process
+	static const float* GetTaps();
+
+	void SetMaxBlockSize(const int32 InMaxNumSamples);
+	void Reset();
+	// OutBuffer holds 2 * InNumSamples
+	void Upsample(const float* InBuffer, float* OutBuffer, const int32 InNumSamples);
+	// InBuffer holds 2 * InNumSamples
+	void Downsample(const float* InBuffer, float* OutBuffer, const int32 InNumSamples);
+
+private:
+	// history followed by the current block
+	TArray<float> UpInput;
+	TArray<float> DownEven;
+	TArray<float> DownOdd;
+};
+
+// 32 taps pass to 0.44 of the base rate and reject by 70dB above 0.58. The second stage of 4x only has to keep
+// its images out of the first stage's passband, so 12 taps are enough there.
+template<int32 Factor>
+class TOversampler
+{
+	static_assert(Factor == 2 || Factor == 4, "2x or 4x only");
+
+public:
+	// Round trip delay in base rate samples
+	static constexpr int32 Latency = Factor == 2 ? 2 * THalfbandResampler<32>::Latency : 2 * THalfbandResampler<32>::Latency + THalfbandResampler<12>::Latency;
+
+	void SetMaxBlockSize(const int32 InMaxNumSamples)
+	{
+		Outer.SetMaxBlockSize(InMaxNumSamples);
+		if constexpr (Factor == 4)
+		{
+			Inner.SetMaxBlockSize(2 * InMaxNumSamples);
+			Intermediate.SetNumUninitialized(2 * InMaxNumSamples);
+		}
+	}
+
+	void Reset()
+	{
+		Outer.Reset();
+		Inner.Reset();
+	}
+
+	// OutBuffer holds Factor * InNumSamples
+	void Upsample(const float* InBuffer, float* OutBuffer, const int32 InNumSamples)
+	{
+		if constexpr (Factor == 4)
+		{
+			if (Intermediate.Num() < 2 * InNumSamples)
+			{
+				SetMaxBlockSize(InNumSamples);
+			}
+			Outer.Upsample(InBuffer, Intermediate.GetData(), InNumSamples);
+			Inner.Upsample(Intermediate.GetData(), OutBuffer, 2 * InNumSamples);
+		}
+		else
+		{
+			Outer.Upsample(InBuffer, OutBuffer, InNumSamples);
+		}
+	}
+
+	// InBuffer holds Factor * InNumSamples
+	void Downsample(const float* InBuffer, float* OutBuffer, const int32 InNumSamples)
+	{
+		if constexpr (Factor == 4)
+		{
+			if (Intermediate.Num() < 2 * InNumSamples)
+			{
+				SetMaxBlockSize(InNumSamples);
+			}
+			Inner.Downsample(InBuffer, Intermediate.GetData(), 2 * InNumSamples);
+			Outer.Downsample(Intermediate.GetData(), OutBuffer, InNumSamples);
+		}
+		else
+		{
+			Outer.Downsample(InBuffer, OutBuffer, InNumSamples);
+		}
+	}
+
+private:
+	THalfbandResampler<32> Outer;
+	THalfbandResampler<12> Inner;	// unused at 2x
+	TArray<float> Intermediate;		// 2x rate signal between the stages at 4x
+};
+
+// Runs a memoryless kernel at Factor times the block rate. The kernel's ProcessAudioBuffer must work in place.
+template<typename KernelType, int32 Factor>
+class TOversampled
+{
+public:
+	KernelType& GetKernel() { return Kernel; }
+
+	void SetMaxBlockSize(const int32 InMaxNumSamples)
+	{
+		Oversampler.SetMaxBlockSize(InMaxNumSamples);
+		Upsampled.SetNumUninitialized(Factor * InMaxNumSamples);
+		HeldControl.SetNumUninitialized(Factor * InMaxNumSamples);
+	}
+
+	void Reset()
+	{
+		Oversampler.Reset();
+	}
+
+	void ProcessAudioBuffer(const float* InBuffer, float* OutBuffer, const int32 InNumSamples)
+	{
+		// sized up front, only a block larger than the operator settings grows the buffers here
+		if (UNLIKELY(Upsampled.Num() < Factor * InNumSamples))
+		{
+			SetMaxBlockSize(InNumSamples);
+		}
+
+		float* Work = Upsampled.GetData();
+		Oversampler.Upsample(InBuffer, Work, InNumSamples);
+		Kernel.ProcessAudioBuffer(Work, Work, Factor * InNumSamples);
+		Oversampler.Downsample(Work, OutBuffer, InNumSamples);
+	}
+
+	// For kernels with a second input such as FPow, which is held across each group of Factor samples
+	void ProcessAudioBuffer(const float* InBuffer, float* OutBuffer, const float* InControl, const int32 InNumSamples)
+	{
+		if (UNLIKELY(Upsampled.Num() < Factor * InNumSamples))
+		{
+			SetMaxBlockSize(InNumSamples);
+		}
+
+		float* Work = Upsampled.GetData();
+		float* Control = HeldControl.GetData();
+		for (int32 Index = 0; Index < InNumSamples; ++Index)
+		{
+			for (int32 Phase = 0; Phase < Factor; ++Phase)
+			{
+				Control[Factor * Index + Phase] = InControl[Index];
+			}
+		}
+
+		Oversampler.Upsample(InBuffer, Work, InNumSamples);
+		Kernel.ProcessAudioBuffer(Work, Work, Control, Factor * InNumSamples);
+		Oversampler.Downsample(Work, OutBuffer, InNumSamples);
+	}
+
+private:
+	KernelType Kernel;
+	TOversampler<Factor> Oversampler;
+	TArray<float> Upsampled;
+	TArray<float> HeldControl;
+};
+
+// Holds both factors so switching between them never allocates. Size it once with SetMaxBlockSize from the
+// operator constructor, Execute only selects. At EOversample::None the node runs its own kernel.
+template<typename KernelType>
+class TSelectableOversampled
+{
+public:
+	void SetMaxBlockSize(const int32 InMaxNumSamples)
+	{
+		Oversampled2x.SetMaxBlockSize(InMaxNumSamples);
+		Oversampled4x.SetMaxBlockSize(InMaxNumSamples);
+	}
+
+	// A newly selected factor starts from silent filter history, cheap enough to call every block
+	void SetOversample(const EOversample InOversample)
+	{
+		if (InOversample == Oversample)
+		{
+			return;
+		}
+
+		Oversample = InOversample;
+		if (Oversample == EOversample::X2)
+		{
+			Oversampled2x.Reset();
+		}
+		else if (Oversample == EOversample::X4)
+		{
+			Oversampled4x.Reset();
+		}
+	}
+
+	EOversample GetOversample() const { return Oversample; }
+
+	// Settings such as accuracy have to reach both factors' kernels
+	template<typename FuncType>
+	void ForEachKernel(FuncType&& InFunc)
+	{
+		InFunc(Oversampled2x.GetKernel());
+		InFunc(Oversampled4x.GetKernel());
+	}
+
+	// Leaves OutBuffer untouched at EOversample::None
+	void ProcessAudioBuffer(const float* InBuffer, float* OutBuffer, const int32 InNumSamples)
+	{
+		if (Oversample == EOversample::X2)
+		{
+			Oversampled2x.ProcessAudioBuffer(InBuffer, OutBuffer, InNumSamples);
+		}
+		else if (Oversample == EOversample::X4)
+		{
+			Oversampled4x.ProcessAudioBuffer(InBuffer, OutBuffer, InNumSamples);
+		}
+	}
+
+	void ProcessAudioBuffer(const float* InBuffer, float* OutBuffer, const float* InControl, const int32 InNumSamples)
+	{
+		if (Oversample == EOversample::X2)
+		{
+			Oversampled2x.ProcessAudioBuffer(InBuffer, OutBuffer, InControl, InNumSamples);
+		}
+		else if (Oversample == EOversample::X4)
+		{
+			Oversampled4x.ProcessAudioBuffer(InBuffer, OutBuffer, InControl, InNumSamples);
+		}
+	}
+
+private:
+	TOversampled<KernelType, 2> Oversampled2x;
+	TOversampled<KernelType, 4> Oversampled4x;
+	EOversample Oversample = EOversample::None;
+};
+
+// Stands in for the ADAA kernel of nodes that don't have one
+struct FNoADAA {};
+
+// A nonlinear node's kernel with its oversampled and ADAA alternatives. Oversampling wins over ADAA, and the ADAA
+// kernel is reset to the block's first sample when it comes back on, its previous input is stale after a block on
+// another path and starting from 0 would click.
+template<typename KernelType, typename ADAAKernelType = FNoADAA>
+class TAntialiased
+{
+public:
+	static constexpr bool bHasADAA = !std::is_same_v<ADAAKernelType, FNoADAA>;
+
+	void SetMaxBlockSize(const int32 InMaxNumSamples)
+	{
+		Oversampled.SetMaxBlockSize(InMaxNumSamples);
+	}
+
+	// bInUseADAA is ignored without an ADAA kernel
+	void SetMode(const EOversample InOversample, const bool bInUseADAA = false)
+	{
+		Oversampled.SetOversample(InOversample);
+		bUseADAA = bHasADAA && bInUseADAA;
+	}
+
+	// Every kernel but the ADAA one, for settings such as accuracy
+	template<typename FuncType>
+	void ForEachKernel(FuncType&& InFunc)
+	{
+		InFunc(Kernel);
+		Oversampled.ForEachKernel(InFunc);
+	}
+
+	void ProcessAudioBuffer(const float* InBuffer, float* OutBuffer, const int32 InNumSamples)
+	{
+		switch (BeginBlock(InBuffer, InNumSamples))
+		{
+		case EPath::Oversampled:
+			Oversampled.ProcessAudioBuffer(InBuffer, OutBuffer, InNumSamples);
+			break;
+
+		case EPath::ADAA:
+			if constexpr (bHasADAA)
+			{
+				ADAAKernel.ProcessAudioBuffer(InBuffer, OutBuffer, InNumSamples);
+			}
+			break;
+
+		default:
+			Kernel.ProcessAudioBuffer(InBuffer, OutBuffer, InNumSamples);
+			break;
+		}
+	}
+
+	void ProcessAudioBuffer(const float* InBuffer, float* OutBuffer, const float* InControl, const int32 InNumSamples)
+	{
+		switch (BeginBlock(InBuffer, InNumSamples))
+		{
+		case EPath::Oversampled:
+			Oversampled.ProcessAudioBuffer(InBuffer, OutBuffer, InControl, InNumSamples);
+			break;
+
+		case EPath::ADAA:
+			if constexpr (bHasADAA)
+			{
+				ADAAKernel.ProcessAudioBuffer(InBuffer, OutBuffer, InControl, InNumSamples);
+			}
+			break;
+
+		default:
+			Kernel.ProcessAudioBuffer(InBuffer, OutBuffer, InControl, InNumSamples);
+			break;
+		}
+	}
+
+private:
+	enum class EPath : uint8
+	{
+		Kernel,
+		Oversampled,
+		ADAA
+	};
+
+	EPath BeginBlock(const float* InBuffer, const int32 InNumSamples)
+	{
+		if (Oversampled.GetOversample() != EOversample::None)
+		{
+			bADAAActive = false;
+			return EPath::Oversampled;
+		}
+
+		if constexpr (bHasADAA)
+		{
+			if (bUseADAA)
+			{
+				if (!bADAAActive)
+				{
+					ADAAKernel.Reset(InNumSamples > 0 ? InBuffer[0] : 0.0f);
+					bADAAActive = true;
+				}
+				return EPath::ADAA;
+			}
+		}
+
+		bADAAActive = false;
+		return EPath::Kernel;
+	}
+
+	KernelType Kernel;
+	TSelectableOversampled<KernelType> Oversampled;
+	ADAAKernelType ADAAKernel;
+	bool bUseADAA = false;
+	bool bADAAActive = false;
+};
+
+} // namespace DSPProcessing
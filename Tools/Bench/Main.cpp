@@ -0,0 +1,88 @@
+// Copyright Christopher Wratt 2024.
+// All code under MIT license: see https://mit-license.org/
+
+// Runs the plugin's developer console commands and automation tests outside the editor.
+//
+//   MetasoundsAudioMathUtilsBench                   lists the commands and tests
+//   MetasoundsAudioMathUtilsBench <command> [args]  runs a console command with the same arguments as in the editor
+//   MetasoundsAudioMathUtilsBench -test [filter]    runs the tests whose name contains filter, exits non-zero on failure
+
+#include "CoreMinimal.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/AutomationTest.h"
+
+namespace
+{
+	void ListAll()
+	{
+		printf("Commands:\n");
+		for (const FStandaloneConsoleCommand& Command : FStandaloneConsoleCommand::GetRegistered())
+		{
+			printf("  %-36s %s\n", Command.Name, Command.Help);
+		}
+
+		printf("Tests (-test [filter]):\n");
+		for (const FAutomationTestBase* Test : FAutomationTestBase::GetRegistered())
+		{
+			printf("  %s\n", *Test->GetTestName());
+		}
+	}
+
+	int32 RunTests(const TCHAR* InFilter)
+	{
+		int32 NumRun = 0;
+		int32 NumFailed = 0;
+		for (FAutomationTestBase* Test : FAutomationTestBase::GetRegistered())
+		{
+			if (InFilter && !FCString::Stristr(*Test->GetTestName(), InFilter))
+			{
+				continue;
+			}
+
+			printf("Running %s\n", *Test->GetTestName());
+			Test->ClearErrors();
+			const bool bPassed = Test->RunTest(FString()) && !Test->HasAnyErrors();
+			printf("%s %s\n", bPassed ? "Passed" : "FAILED", *Test->GetTestName());
+
+			++NumRun;
+			NumFailed += bPassed ? 0 : 1;
+		}
+
+		printf("%d of %d tests passed\n", NumRun - NumFailed, NumRun);
+		return NumRun > 0 && NumFailed == 0 ? 0 : 1;
+	}
+}
+
+int main(int ArgC, char** ArgV)
+{
+	if (ArgC < 2)
+	{
+		ListAll();
+		return 0;
+	}
+
+	if (strcmp(ArgV[1], "-test") == 0)
+	{
+		return RunTests(ArgC > 2 ? ArgV[2] : nullptr);
+	}
+
+	for (const FStandaloneConsoleCommand& Command : FStandaloneConsoleCommand::GetRegistered())
+	{
+		if (strcasecmp(Command.Name, ArgV[1]) == 0)
+		{
+			TArray<FString> Args;
+			for (int32 Arg = 2; Arg < ArgC; ++Arg)
+			{
+				Args.Add(FString(ArgV[Arg]));
+			}
+
+			FOutputDevice Ar;
+			Command.Execute(Args, Ar);
+			return 0;
+		}
+	}
+
+	fprintf(stderr, "Unknown command %s\n", ArgV[1]);
+	ListAll();
+	return 1;
+}
@@ -0,0 +1,174 @@
+// Copyright Christopher Wratt 2024.
+// All code under MIT license: see https://mit-license.org/
+
+// Just enough of Core for the DSP kernels, the benchmarks and the automation tests to build as a plain
+// executable outside the editor. Only what the plugin's kernel code uses is here, and only as far as it uses it.
+// The engine headers stay authoritative, anything added to the kernels that this doesn't cover needs adding here.
+
+#pragma once
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <math.h>
+#include <memory>
+#include <string>
+#include <strings.h>
+#include <utility>
+#include <vector>
+
+#include "HAL/Platform.h"
+
+#define FORCEINLINE inline __attribute__((always_inline))
+#define TEXT(x) x
+#define LIKELY(x) __builtin_expect(!!(x), 1)
+#define UNLIKELY(x) __builtin_expect(!!(x), 0)
+#define UE_ARRAY_COUNT(Array) (sizeof(Array) / sizeof((Array)[0]))
+
+#define check(Expression)
+#define checkSlow(Expression)
+
+#define INDEX_NONE (-1)
+#define MIN_int32 ((int32)0x80000000)
+
+#define PI (3.1415926535897932f)
+#define UE_PI (3.1415926535897932f)
+#define UE_DOUBLE_PI (3.141592653589793238462643383279502884197169399)
+#define UE_SQRT_2 (1.4142135623730950488016887242097f)
+
+template<typename T>
+struct TNumericLimits
+{
+	static constexpr T Min() { return std::numeric_limits<T>::lowest(); }
+	static constexpr T Max() { return std::numeric_limits<T>::max(); }
+};
+
+struct FMemory
+{
+	static void* Memcpy(void* Dest, const void* Src, SIZE_T Count) { return memcpy(Dest, Src, Count); }
+	static void* Memmove(void* Dest, const void* Src, SIZE_T Count) { return memmove(Dest, Src, Count); }
+	static void* Memzero(void* Dest, SIZE_T Count) { return memset(Dest, 0, Count); }
+	static void* Memset(void* Dest, uint8 Char, SIZE_T Count) { return memset(Dest, Char, Count); }
+};
+
+template<typename T>
+class TArray
+{
+public:
+	TArray() = default;
+	TArray(std::initializer_list<T> InList) : Data(InList) {}
+
+	int32 Num() const { return (int32)Data.size(); }
+	bool IsEmpty() const { return Data.empty(); }
+	bool IsValidIndex(int32 Index) const { return Index >= 0 && Index < Num(); }
+	T* GetData() { return Data.data(); }
+	const T* GetData() const { return Data.data(); }
+
+	T& operator[](int32 Index) { return Data[Index]; }
+	const T& operator[](int32 Index) const { return Data[Index]; }
+	T& Last() { return Data.back(); }
+	const T& Last() const { return Data.back(); }
+
+	int32 Add(const T& Item) { Data.push_back(Item); return Num() - 1; }
+	int32 Add(T&& Item) { Data.push_back(std::move(Item)); return Num() - 1; }
+	template<typename... ArgsType>
+	int32 Emplace(ArgsType&&... Args) { Data.emplace_back(std::forward<ArgsType>(Args)...); return Num() - 1; }
+	T& AddDefaulted_GetRef() { Data.emplace_back(); return Data.back(); }
+	int32 AddUninitialized(int32 Count = 1) { Data.resize(Data.size() + Count); return Num() - Count; }
+	int32 AddZeroed(int32 Count = 1) { Data.resize(Data.size() + Count, T()); return Num() - Count; }
+
+	void SetNum(int32 NewNum) { Data.resize(NewNum); }
+	void SetNumUninitialized(int32 NewNum) { Data.resize(NewNum); }
+	// growing keeps the existing elements, as in the engine
+	void SetNumZeroed(int32 NewNum) { Data.resize(NewNum, T()); }
+	void Init(const T& Element, int32 Count) { Data.assign(Count, Element); }
+	void Reserve(int32 Count) { Data.reserve(Count); }
+	void Reset(int32 NewSize = 0) { Data.clear(); Data.reserve(NewSize); }
+	void Empty(int32 Slack = 0) { Data.clear(); Data.shrink_to_fit(); Data.reserve(Slack); }
+
+	void Sort() { std::sort(Data.begin(), Data.end()); }
+	template<typename PredicateType>
+	void Sort(PredicateType Predicate) { std::sort(Data.begin(), Data.end(), Predicate); }
+
+	T* begin() { return Data.data(); }
+	T* end() { return Data.data() + Data.size(); }
+	const T* begin() const { return Data.data(); }
+	const T* end() const { return Data.data() + Data.size(); }
+
+private:
+	std::vector<T> Data;
+};
+
+template<typename T>
+class TUniquePtr : public std::unique_ptr<T>
+{
+public:
+	using std::unique_ptr<T>::unique_ptr;
+	TUniquePtr() = default;
+	TUniquePtr(std::unique_ptr<T>&& Other) : std::unique_ptr<T>(std::move(Other)) {}
+	template<typename OtherType>
+	TUniquePtr(TUniquePtr<OtherType>&& Other) : std::unique_ptr<T>(std::move(Other)) {}
+
+	T* Get() const { return this->get(); }
+	bool IsValid() const { return this->get() != nullptr; }
+	void Reset(T* InPtr = nullptr) { this->reset(InPtr); }
+};
+
+template<typename T, typename... ArgsType>
+TUniquePtr<T> MakeUnique(ArgsType&&... Args)
+{
+	return TUniquePtr<T>(new T(std::forward<ArgsType>(Args)...));
+}
+
+// TCHAR is char here, so FString is a std::string with the handful of engine members the plugin calls
+class FString : public std::string
+{
+public:
+	FString() = default;
+	FString(const char* InString) : std::string(InString ? InString : "") {}
+	FString(const std::string& InString) : std::string(InString) {}
+	FString(std::string&& InString) : std::string(std::move(InString)) {}
+
+	const TCHAR* operator*() const { return c_str(); }
+	int32 Len() const { return (int32)size(); }
+	bool IsEmpty() const { return empty(); }
+	bool StartsWith(const TCHAR* InPrefix) const { return strncasecmp(c_str(), InPrefix, strlen(InPrefix)) == 0; }
+
+	static FString Printf(const TCHAR* InFormat, ...) __attribute__((format(printf, 1, 2)))
+	{
+		va_list Args;
+		va_start(Args, InFormat);
+		va_list ArgsCopy;
+		va_copy(ArgsCopy, Args);
+		const int Length = vsnprintf(nullptr, 0, InFormat, ArgsCopy);
+		va_end(ArgsCopy);
+
+		FString Result;
+		Result.resize(Length > 0 ? Length : 0);
+		vsnprintf(Result.data(), Length + 1, InFormat, Args);
+		va_end(Args);
+		return Result;
+	}
+};
+
+struct FCString
+{
+	static const TCHAR* Stristr(const TCHAR* InString, const TCHAR* InFind) { return strcasestr(InString, InFind); }
+	static int32 Atoi(const TCHAR* InString) { return atoi(InString); }
+	static float Atof(const TCHAR* InString) { return (float)atof(InString); }
+	static bool IsNumeric(const TCHAR* InString)
+	{
+		char* End = nullptr;
+		strtod(InString, &End);
+		return *InString != '\0' && *End == '\0';
+	}
+};
+
+#include "Math/UnrealMathUtility.h"
+#include "Math/VectorRegister.h"
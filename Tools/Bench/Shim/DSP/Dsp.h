@@ -0,0 +1,18 @@
+// Copyright Christopher Wratt 2024.
+// All code under MIT license: see https://mit-license.org/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace Audio
+{
+	// SignalProcessing's rational tan approximation
+	static FORCEINLINE float FastTan(const float X)
+	{
+		const float X2 = X * X;
+		const float Num = X * (-135135.0f + X2 * (17325.0f + X2 * (-378.0f + X2)));
+		const float Den = -135135.0f + X2 * (62370.0f + X2 * (-3150.0f + 28.0f * X2));
+		return Num / Den;
+	}
+}
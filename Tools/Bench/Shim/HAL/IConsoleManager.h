@@ -0,0 +1,70 @@
+// Copyright Christopher Wratt 2024.
+// All code under MIT license: see https://mit-license.org/
+
+#pragma once
+
+#include <functional>
+
+#include "CoreMinimal.h"
+
+class FOutputDevice
+{
+public:
+	void Logf(const TCHAR* InFormat, ...) __attribute__((format(printf, 2, 3)))
+	{
+		va_list Args;
+		va_start(Args, InFormat);
+		vprintf(InFormat, Args);
+		va_end(Args);
+		printf("\n");
+	}
+};
+
+// The engine declares GLog in CoreGlobals.h, here it is one more device printing to stdout
+inline FOutputDevice GLogDevice;
+inline FOutputDevice* GLog = &GLogDevice;
+
+struct FConsoleCommandWithOutputDeviceDelegate
+{
+	static FConsoleCommandWithOutputDeviceDelegate CreateStatic(void (*InFunction)(FOutputDevice&)) { return { InFunction }; }
+	void (*Function)(FOutputDevice&);
+};
+
+struct FConsoleCommandWithArgsAndOutputDeviceDelegate
+{
+	static FConsoleCommandWithArgsAndOutputDeviceDelegate CreateStatic(void (*InFunction)(const TArray<FString>&, FOutputDevice&)) { return { InFunction }; }
+	void (*Function)(const TArray<FString>&, FOutputDevice&);
+};
+
+// Every FAutoConsoleCommand* registers here instead of with the console manager, the standalone main runs them by name
+struct FStandaloneConsoleCommand
+{
+	const TCHAR* Name;
+	const TCHAR* Help;
+	std::function<void(const TArray<FString>&, FOutputDevice&)> Execute;
+
+	static TArray<FStandaloneConsoleCommand>& GetRegistered()
+	{
+		static TArray<FStandaloneConsoleCommand> Commands;
+		return Commands;
+	}
+};
+
+class FAutoConsoleCommandWithOutputDevice
+{
+public:
+	FAutoConsoleCommandWithOutputDevice(const TCHAR* InName, const TCHAR* InHelp, const FConsoleCommandWithOutputDeviceDelegate& InCommand)
+	{
+		void (*Function)(FOutputDevice&) = InCommand.Function;
+		FStandaloneConsoleCommand::GetRegistered().Add({ InName, InHelp, [Function](const TArray<FString>&, FOutputDevice& Ar) { Function(Ar); } });
+	}
+};
+
+class FAutoConsoleCommandWithArgsAndOutputDevice
+{
+public:
+	FAutoConsoleCommandWithArgsAndOutputDevice(const TCHAR* InName, const TCHAR* InHelp, const FConsoleCommandWithArgsAndOutputDeviceDelegate& InCommand)
+	{
+		FStandaloneConsoleCommand::GetRegistered().Add({ InName, InHelp, InCommand.Function });
+	}
+};
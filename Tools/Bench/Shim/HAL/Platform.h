@@ -0,0 +1,35 @@
+// Copyright Christopher Wratt 2024.
+// All code under MIT license: see https://mit-license.org/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#ifndef PLATFORM_LINUX
+#if defined(__linux__)
+#define PLATFORM_LINUX 1
+#else
+#define PLATFORM_LINUX 0
+#endif
+#endif
+
+// the standalone build stands in for a development build, so the console commands are compiled in
+#ifndef UE_BUILD_SHIPPING
+#define UE_BUILD_SHIPPING 0
+#endif
+
+#ifndef METASOUNDSAUDIOMATHUTILS_API
+#define METASOUNDSAUDIOMATHUTILS_API
+#endif
+
+typedef int8_t int8;
+typedef int16_t int16;
+typedef int32_t int32;
+typedef int64_t int64;
+typedef uint8_t uint8;
+typedef uint16_t uint16;
+typedef uint32_t uint32;
+typedef uint64_t uint64;
+typedef size_t SIZE_T;
+typedef char TCHAR;
@@ -0,0 +1,20 @@
+// Copyright Christopher Wratt 2024.
+// All code under MIT license: see https://mit-license.org/
+
+#pragma once
+
+#include <chrono>
+
+#include "CoreMinimal.h"
+
+// Nanosecond cycles off the steady clock, like the engine's clock_gettime based Linux implementation
+struct FPlatformTime
+{
+	static uint64 Cycles64()
+	{
+		return (uint64)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+	}
+
+	static double GetSecondsPerCycle64() { return 1.0e-9; }
+	static double Seconds() { return (double)Cycles64() * GetSecondsPerCycle64(); }
+};
@@ -0,0 +1,32 @@
+// Copyright Christopher Wratt 2024.
+// All code under MIT license: see https://mit-license.org/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Same generator as the engine's, so a seeded fill gives the same samples in the editor and here
+struct FRandomStream
+{
+	explicit FRandomStream(const int32 InSeed)
+		: Seed((uint32)InSeed)
+	{
+	}
+
+	// [0, 1)
+	float GetFraction()
+	{
+		Seed = (Seed * 196314165U) + 907633515U;
+		const uint32 Bits = 0x3F800000U | (Seed >> 9);
+		float Result;
+		FMemory::Memcpy(&Result, &Bits, sizeof(float));
+		return Result - 1.0f;
+	}
+
+	float FRand() { return GetFraction(); }
+	float FRandRange(const float InMin, const float InMax) { return InMin + (InMax - InMin) * FRand(); }
+	int32 RandRange(const int32 InMin, const int32 InMax) { return InMin + FMath::Min((int32)(FRand() * (float)(InMax - InMin + 1)), InMax - InMin); }
+
+private:
+	uint32 Seed;
+};
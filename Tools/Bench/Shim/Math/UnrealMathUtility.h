@@ -0,0 +1,67 @@
+// Copyright Christopher Wratt 2024.
+// All code under MIT license: see https://mit-license.org/
+
+#pragma once
+
+#include <cmath>
+#include <type_traits>
+
+#include "HAL/Platform.h"
+
+// Float and double overloads of the FMath functions the plugin calls, with the engine's semantics
+struct FMath
+{
+	template<typename T>
+	static constexpr T Abs(const T A) { return A < (T)0 ? -A : A; }
+	template<typename T>
+	static constexpr T Square(const T A) { return A * A; }
+	template<typename T>
+	static constexpr T Sign(const T A) { return A > (T)0 ? (T)1 : (A < (T)0 ? (T)-1 : (T)0); }
+
+	// mixed argument types promote, as the engine's overloads do
+	template<typename T, typename U>
+	static constexpr std::common_type_t<T, U> Min(const T A, const U B) { return A <= B ? A : B; }
+	template<typename T, typename U>
+	static constexpr std::common_type_t<T, U> Max(const T A, const U B) { return A >= B ? A : B; }
+	template<typename T>
+	static constexpr T Clamp(const T X, const T InMin, const T InMax) { return X < InMin ? InMin : (X < InMax ? X : InMax); }
+	template<typename T>
+	static constexpr T Lerp(const T A, const T B, const float Alpha) { return (T)(A + Alpha * (B - A)); }
+
+	static float Sin(const float Value) { return sinf(Value); }
+	static double Sin(const double Value) { return sin(Value); }
+	static float Cos(const float Value) { return cosf(Value); }
+	static double Cos(const double Value) { return cos(Value); }
+	static float Tan(const float Value) { return tanf(Value); }
+	static double Tan(const double Value) { return tan(Value); }
+	static float Sqrt(const float Value) { return sqrtf(Value); }
+	static double Sqrt(const double Value) { return sqrt(Value); }
+	static float InvSqrt(const float Value) { return 1.0f / sqrtf(Value); }
+	static float Pow(const float A, const float B) { return powf(A, B); }
+	static double Pow(const double A, const double B) { return pow(A, B); }
+	static float Exp(const float Value) { return expf(Value); }
+	static float Exp2(const float Value) { return exp2f(Value); }
+	static float Loge(const float Value) { return logf(Value); }
+	static float Log2(const float Value) { return log2f(Value); }
+
+	static float Fmod(const float X, const float Y) { return fmodf(X, Y); }
+	static double Fmod(const double X, const double Y) { return fmod(X, Y); }
+	static float Frac(const float Value) { return Value - floorf(Value); }
+	static float FloorToFloat(const float Value) { return floorf(Value); }
+	static double FloorToDouble(const double Value) { return floor(Value); }
+	static int32 FloorToInt(const float Value) { return (int32)floorf(Value); }
+	static float CeilToFloat(const float Value) { return ceilf(Value); }
+	static double CeilToDouble(const double Value) { return ceil(Value); }
+	static int32 CeilToInt(const float Value) { return (int32)ceilf(Value); }
+	static float TruncToFloat(const float Value) { return truncf(Value); }
+	static int32 TruncToInt(const float Value) { return (int32)Value; }
+	static int32 RoundToInt(const float Value) { return (int32)floorf(Value + 0.5f); }
+	static float RoundHalfFromZero(const float Value) { return roundf(Value); }
+
+	static bool IsNaN(const float Value) { return std::isnan(Value); }
+	static bool IsNaN(const double Value) { return std::isnan(Value); }
+	static bool IsFinite(const float Value) { return std::isfinite(Value); }
+	static bool IsFinite(const double Value) { return std::isfinite(Value); }
+	static bool IsNearlyEqual(const float A, const float B, const float Tolerance = 1.e-8f) { return fabsf(A - B) <= Tolerance; }
+	static bool IsNearlyZero(const float Value, const float Tolerance = 1.e-8f) { return fabsf(Value) <= Tolerance; }
+};
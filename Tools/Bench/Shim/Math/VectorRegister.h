@@ -0,0 +1,84 @@
+// Copyright Christopher Wratt 2024.
+// All code under MIT license: see https://mit-license.org/
+
+// The engine's SSE VectorRegister functions the kernels use, with the same lane semantics. Masks are all ones
+// or all zeros per lane, VectorFloatToInt truncates and VectorMultiplyAdd is an unfused multiply then add, as in
+// an SSE4.1 build without FMA.
+
+#pragma once
+
+#include <smmintrin.h>
+
+#include "HAL/Platform.h"
+
+typedef __m128 VectorRegister4Float;
+typedef __m128i VectorRegister4Int;
+
+#define FORCEINLINE_VECTOR inline __attribute__((always_inline))
+
+FORCEINLINE_VECTOR VectorRegister4Float VectorLoad(const float* Ptr) { return _mm_loadu_ps(Ptr); }
+FORCEINLINE_VECTOR VectorRegister4Float VectorLoadAligned(const float* Ptr) { return _mm_load_ps(Ptr); }
+FORCEINLINE_VECTOR VectorRegister4Float VectorLoadFloat1(const float* Ptr) { return _mm_load1_ps(Ptr); }
+FORCEINLINE_VECTOR void VectorStore(const VectorRegister4Float& Vec, float* Ptr) { _mm_storeu_ps(Ptr, Vec); }
+FORCEINLINE_VECTOR void VectorStoreAligned(const VectorRegister4Float& Vec, float* Ptr) { _mm_store_ps(Ptr, Vec); }
+FORCEINLINE_VECTOR void VectorStoreFloat1(const VectorRegister4Float& Vec, float* Ptr) { _mm_store_ss(Ptr, Vec); }
+
+FORCEINLINE_VECTOR VectorRegister4Float VectorSetFloat1(const float Value) { return _mm_set1_ps(Value); }
+FORCEINLINE_VECTOR VectorRegister4Float MakeVectorRegisterFloat(const float X, const float Y, const float Z, const float W) { return _mm_setr_ps(X, Y, Z, W); }
+FORCEINLINE_VECTOR VectorRegister4Float VectorZeroFloat() { return _mm_setzero_ps(); }
+FORCEINLINE_VECTOR VectorRegister4Float VectorOneFloat() { return _mm_set1_ps(1.0f); }
+FORCEINLINE_VECTOR float VectorGetComponent(const VectorRegister4Float& Vec, const int32 Index)
+{
+	alignas(16) float Lanes[4];
+	_mm_store_ps(Lanes, Vec);
+	return Lanes[Index];
+}
+
+FORCEINLINE_VECTOR VectorRegister4Float VectorAdd(const VectorRegister4Float& A, const VectorRegister4Float& B) { return _mm_add_ps(A, B); }
+FORCEINLINE_VECTOR VectorRegister4Float VectorSubtract(const VectorRegister4Float& A, const VectorRegister4Float& B) { return _mm_sub_ps(A, B); }
+FORCEINLINE_VECTOR VectorRegister4Float VectorMultiply(const VectorRegister4Float& A, const VectorRegister4Float& B) { return _mm_mul_ps(A, B); }
+FORCEINLINE_VECTOR VectorRegister4Float VectorDivide(const VectorRegister4Float& A, const VectorRegister4Float& B) { return _mm_div_ps(A, B); }
+// A * B + C
+FORCEINLINE_VECTOR VectorRegister4Float VectorMultiplyAdd(const VectorRegister4Float& A, const VectorRegister4Float& B, const VectorRegister4Float& C) { return _mm_add_ps(_mm_mul_ps(A, B), C); }
+// C - A * B
+FORCEINLINE_VECTOR VectorRegister4Float VectorNegateMultiplyAdd(const VectorRegister4Float& A, const VectorRegister4Float& B, const VectorRegister4Float& C) { return _mm_sub_ps(C, _mm_mul_ps(A, B)); }
+FORCEINLINE_VECTOR VectorRegister4Float VectorMin(const VectorRegister4Float& A, const VectorRegister4Float& B) { return _mm_min_ps(A, B); }
+FORCEINLINE_VECTOR VectorRegister4Float VectorMax(const VectorRegister4Float& A, const VectorRegister4Float& B) { return _mm_max_ps(A, B); }
+FORCEINLINE_VECTOR VectorRegister4Float VectorAbs(const VectorRegister4Float& Vec) { return _mm_andnot_ps(_mm_set1_ps(-0.0f), Vec); }
+FORCEINLINE_VECTOR VectorRegister4Float VectorNegate(const VectorRegister4Float& Vec) { return _mm_sub_ps(_mm_setzero_ps(), Vec); }
+FORCEINLINE_VECTOR VectorRegister4Float VectorFloor(const VectorRegister4Float& Vec) { return _mm_floor_ps(Vec); }
+FORCEINLINE_VECTOR VectorRegister4Float VectorCeil(const VectorRegister4Float& Vec) { return _mm_ceil_ps(Vec); }
+FORCEINLINE_VECTOR VectorRegister4Float VectorTruncate(const VectorRegister4Float& Vec) { return _mm_round_ps(Vec, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC); }
+FORCEINLINE_VECTOR VectorRegister4Float VectorSqrt(const VectorRegister4Float& Vec) { return _mm_sqrt_ps(Vec); }
+FORCEINLINE_VECTOR VectorRegister4Float VectorReciprocalSqrtEstimate(const VectorRegister4Float& Vec) { return _mm_rsqrt_ps(Vec); }
+FORCEINLINE_VECTOR VectorRegister4Float VectorReciprocalEstimate(const VectorRegister4Float& Vec) { return _mm_rcp_ps(Vec); }
+
+FORCEINLINE_VECTOR VectorRegister4Float VectorCompareEQ(const VectorRegister4Float& A, const VectorRegister4Float& B) { return _mm_cmpeq_ps(A, B); }
+FORCEINLINE_VECTOR VectorRegister4Float VectorCompareNE(const VectorRegister4Float& A, const VectorRegister4Float& B) { return _mm_cmpneq_ps(A, B); }
+FORCEINLINE_VECTOR VectorRegister4Float VectorCompareGT(const VectorRegister4Float& A, const VectorRegister4Float& B) { return _mm_cmpgt_ps(A, B); }
+FORCEINLINE_VECTOR VectorRegister4Float VectorCompareGE(const VectorRegister4Float& A, const VectorRegister4Float& B) { return _mm_cmpge_ps(A, B); }
+FORCEINLINE_VECTOR VectorRegister4Float VectorCompareLT(const VectorRegister4Float& A, const VectorRegister4Float& B) { return _mm_cmplt_ps(A, B); }
+FORCEINLINE_VECTOR VectorRegister4Float VectorCompareLE(const VectorRegister4Float& A, const VectorRegister4Float& B) { return _mm_cmple_ps(A, B); }
+FORCEINLINE_VECTOR VectorRegister4Float VectorSelect(const VectorRegister4Float& Mask, const VectorRegister4Float& A, const VectorRegister4Float& B) { return _mm_or_ps(_mm_and_ps(Mask, A), _mm_andnot_ps(Mask, B)); }
+FORCEINLINE_VECTOR VectorRegister4Float VectorBitwiseAnd(const VectorRegister4Float& A, const VectorRegister4Float& B) { return _mm_and_ps(A, B); }
+FORCEINLINE_VECTOR VectorRegister4Float VectorBitwiseOr(const VectorRegister4Float& A, const VectorRegister4Float& B) { return _mm_or_ps(A, B); }
+FORCEINLINE_VECTOR VectorRegister4Float VectorBitwiseXor(const VectorRegister4Float& A, const VectorRegister4Float& B) { return _mm_xor_ps(A, B); }
+FORCEINLINE_VECTOR int32 VectorMaskBits(const VectorRegister4Float& Vec) { return _mm_movemask_ps(Vec); }
+
+#define VectorSwizzle(Vec, X, Y, Z, W) _mm_shuffle_ps(Vec, Vec, _MM_SHUFFLE(W, Z, Y, X))
+#define VectorReplicate(Vec, Index) _mm_shuffle_ps(Vec, Vec, _MM_SHUFFLE(Index, Index, Index, Index))
+// X and Y from Vec1, Z and W from Vec2
+#define VectorShuffle(Vec1, Vec2, X, Y, Z, W) _mm_shuffle_ps(Vec1, Vec2, _MM_SHUFFLE(W, Z, Y, X))
+
+FORCEINLINE_VECTOR VectorRegister4Int VectorFloatToInt(const VectorRegister4Float& Vec) { return _mm_cvttps_epi32(Vec); }
+FORCEINLINE_VECTOR VectorRegister4Float VectorIntToFloat(const VectorRegister4Int& Vec) { return _mm_cvtepi32_ps(Vec); }
+FORCEINLINE_VECTOR VectorRegister4Float VectorCastIntToFloat(const VectorRegister4Int& Vec) { return _mm_castsi128_ps(Vec); }
+FORCEINLINE_VECTOR VectorRegister4Int VectorCastFloatToInt(const VectorRegister4Float& Vec) { return _mm_castps_si128(Vec); }
+FORCEINLINE_VECTOR VectorRegister4Int VectorIntSet1(const int32 Value) { return _mm_set1_epi32(Value); }
+FORCEINLINE_VECTOR VectorRegister4Int VectorIntAdd(const VectorRegister4Int& A, const VectorRegister4Int& B) { return _mm_add_epi32(A, B); }
+FORCEINLINE_VECTOR VectorRegister4Int VectorIntSubtract(const VectorRegister4Int& A, const VectorRegister4Int& B) { return _mm_sub_epi32(A, B); }
+FORCEINLINE_VECTOR VectorRegister4Int VectorIntAnd(const VectorRegister4Int& A, const VectorRegister4Int& B) { return _mm_and_si128(A, B); }
+FORCEINLINE_VECTOR VectorRegister4Int VectorIntOr(const VectorRegister4Int& A, const VectorRegister4Int& B) { return _mm_or_si128(A, B); }
+#define VectorShiftLeftImm(Vec, Count) _mm_slli_epi32(Vec, Count)
+#define VectorShiftRightImmLogical(Vec, Count) _mm_srli_epi32(Vec, Count)
+#define VectorShiftRightImmArithmetic(Vec, Count) _mm_srai_epi32(Vec, Count)
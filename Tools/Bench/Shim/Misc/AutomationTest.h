@@ -0,0 +1,85 @@
+// Copyright Christopher Wratt 2024.
+// All code under MIT license: see https://mit-license.org/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#define WITH_DEV_AUTOMATION_TESTS 1
+
+namespace EAutomationTestFlags
+{
+	enum Type : uint32
+	{
+		EditorContext = 0x00000001,
+		ClientContext = 0x00000002,
+		ServerContext = 0x00000004,
+		CommandletContext = 0x00000008,
+		SmokeFilter = 0x01000000,
+		EngineFilter = 0x02000000,
+		ProductFilter = 0x04000000,
+		PerfFilter = 0x08000000,
+		StressFilter = 0x10000000,
+	};
+}
+
+// The part of the engine's test base the plugin's tests call. Tests register themselves on construction and the
+// standalone main runs them, a test fails when RunTest returns false or it logged an error.
+class FAutomationTestBase
+{
+public:
+	FAutomationTestBase(const FString& InName, const bool /*bInComplexTask*/)
+		: TestName(InName)
+	{
+		GetRegistered().Add(this);
+	}
+
+	virtual ~FAutomationTestBase() = default;
+	virtual bool RunTest(const FString& Parameters) = 0;
+
+	const FString& GetTestName() const { return TestName; }
+	bool HasAnyErrors() const { return NumErrors > 0; }
+	void ClearErrors() { NumErrors = 0; }
+
+	void AddError(const FString& InError, int32 /*StackOffset*/ = 0)
+	{
+		printf("Error: %s\n", *InError);
+		++NumErrors;
+	}
+
+	void AddWarning(const FString& InWarning, int32 /*StackOffset*/ = 0) { printf("Warning: %s\n", *InWarning); }
+	void AddInfo(const FString& InInfo, int32 /*StackOffset*/ = 0) { printf("%s\n", *InInfo); }
+
+	bool TestTrue(const TCHAR* What, const bool bValue)
+	{
+		if (!bValue)
+		{
+			AddError(FString::Printf(TEXT("Expected '%s' to be true."), What));
+		}
+		return bValue;
+	}
+
+	bool TestFalse(const TCHAR* What, const bool bValue) { return TestTrue(What, !bValue); }
+
+	static TArray<FAutomationTestBase*>& GetRegistered()
+	{
+		static TArray<FAutomationTestBase*> Tests;
+		return Tests;
+	}
+
+private:
+	FString TestName;
+	int32 NumErrors = 0;
+};
+
+#define IMPLEMENT_SIMPLE_AUTOMATION_TEST(TClass, PrettyName, TFlags) \
+	class TClass : public FAutomationTestBase \
+	{ \
+	public: \
+		TClass(const FString& InName) : FAutomationTestBase(InName, false) {} \
+		virtual bool RunTest(const FString& Parameters) override; \
+	}; \
+	namespace \
+	{ \
+		TClass TClass##AutomationTestInstance(TEXT(PrettyName)); \
+	}
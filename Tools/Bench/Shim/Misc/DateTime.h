@@ -0,0 +1,28 @@
+// Copyright Christopher Wratt 2024.
+// All code under MIT license: see https://mit-license.org/
+
+#pragma once
+
+#include <ctime>
+
+#include "CoreMinimal.h"
+
+struct FDateTime
+{
+	static FDateTime Now() { return FDateTime(time(nullptr)); }
+
+	// yyyy.mm.dd-hh.mm.ss, the engine's default format
+	FString ToString() const
+	{
+		char Buffer[32];
+		tm Local;
+		localtime_r(&Time, &Local);
+		strftime(Buffer, sizeof(Buffer), "%Y.%m.%d-%H.%M.%S", &Local);
+		return FString(Buffer);
+	}
+
+private:
+	explicit FDateTime(const time_t InTime) : Time(InTime) {}
+
+	time_t Time;
+};
@@ -0,0 +1,23 @@
+// Copyright Christopher Wratt 2024.
+// All code under MIT license: see https://mit-license.org/
+
+#pragma once
+
+#include <filesystem>
+#include <fstream>
+
+#include "CoreMinimal.h"
+
+struct FFileHelper
+{
+	// Creates the directory tree first, as the engine's file manager does
+	static bool SaveStringToFile(const FString& InString, const TCHAR* InFilename)
+	{
+		std::error_code Error;
+		std::filesystem::create_directories(std::filesystem::path(InFilename).parent_path(), Error);
+
+		std::ofstream File(InFilename, std::ios::binary);
+		File << InString;
+		return File.good();
+	}
+};
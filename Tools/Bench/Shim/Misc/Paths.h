@@ -0,0 +1,30 @@
+// Copyright Christopher Wratt 2024.
+// All code under MIT license: see https://mit-license.org/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FPaths
+{
+	// Saved/Profiling under the working directory, standing in for the project's
+	static FString ProfilingDir() { return FString(TEXT("Saved/Profiling/")); }
+
+	template<typename... PathTypes>
+	static FString Combine(const FString& InFirst, const PathTypes&... InRest)
+	{
+		FString Result = InFirst;
+		(Append(Result, FString(InRest)), ...);
+		return Result;
+	}
+
+private:
+	static void Append(FString& OutPath, const FString& InPart)
+	{
+		if (!OutPath.IsEmpty() && OutPath.back() != '/')
+		{
+			OutPath += '/';
+		}
+		OutPath += InPart;
+	}
+};